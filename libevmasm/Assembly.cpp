@@ -33,6 +33,8 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Parallel.h>
+
 #include <json/json.h>
 
 #include <fstream>
@@ -44,6 +46,34 @@ using namespace solidity::evmasm;
 using namespace solidity::langutil;
 using namespace solidity::util;
 
+namespace
+{
+
+void collectAssemblies(Assembly const& _assembly, set<Assembly const*>& _assemblies)
+{
+	if (!_assemblies.insert(&_assembly).second)
+		return;
+	for (size_t subId = 0; subId < _assembly.numSubs(); ++subId)
+		collectAssemblies(_assembly.sub(subId), _assemblies);
+}
+
+/// @returns true if no assembly can be reached from more than one of the sub-assemblies of @a _assembly.
+bool subAssembliesAreDisjoint(Assembly const& _assembly)
+{
+	set<Assembly const*> reachedAssemblies;
+	for (size_t subId = 0; subId < _assembly.numSubs(); ++subId)
+	{
+		set<Assembly const*> subAssemblies;
+		collectAssemblies(_assembly.sub(subId), subAssemblies);
+		for (Assembly const* subAssembly: subAssemblies)
+			if (!reachedAssemblies.insert(subAssembly).second)
+				return false;
+	}
+	return true;
+}
+
+}
+
 AssemblyItem const& Assembly::append(AssemblyItem const& _i)
 {
 	assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
@@ -403,30 +433,49 @@ Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreat
 }
 
 
-Assembly& Assembly::optimise(OptimiserSettings const& _settings)
+Assembly& Assembly::optimise(OptimiserSettings const& _settings, ThreadPool* _threadPool)
 {
-	optimiseInternal(_settings, {});
+	optimiseInternal(_settings, {}, _threadPool);
 	return *this;
 }
 
 map<u256, u256> Assembly::optimiseInternal(
 	OptimiserSettings const& _settings,
-	std::set<size_t> _tagsReferencedFromOutside
+	std::set<size_t> _tagsReferencedFromOutside,
+	ThreadPool* _threadPool
 )
 {
 	// Run optimisation for sub-assemblies.
+	OptimiserSettings subSettings = _settings;
+	// Disable creation mode for sub-assemblies.
+	subSettings.isCreation = false;
+	// The replacements of a sub-assembly only affect the tags that refer to it,
+	// so the referenced tags of all of them can be determined up front.
+	vector<set<size_t>> subTagsReferencedFromOutside;
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		// Disable creation mode for sub-assemblies.
-		settings.isCreation = false;
-		map<u256, u256> subTagReplacements = m_subs[subId]->optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
+		subTagsReferencedFromOutside.emplace_back(JumpdestRemover::referencedTags(m_items, subId));
+	vector<map<u256, u256>> subTagReplacements(m_subs.size());
+	auto optimiseSub = [&](size_t _subId) {
+		subTagReplacements[_subId] = m_subs[_subId]->optimiseInternal(
+			subSettings,
+			move(subTagsReferencedFromOutside[_subId]),
+			_threadPool
 		);
-		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
+	};
+	// Assemblies of created contracts can be shared between sub-assemblies. These are optimised
+	// repeatedly and the result depends on the order, so they have to be optimised sequentially.
+	if (_threadPool && m_subs.size() > 1 && subAssembliesAreDisjoint(*this))
+	{
+		for (exception_ptr const& failure: _threadPool->parallelFor(m_subs.size(), optimiseSub))
+			if (failure)
+				rethrow_exception(failure);
 	}
+	else
+		for (size_t subId = 0; subId < m_subs.size(); ++subId)
+			optimiseSub(subId);
+	// Apply the replacements (can be empty).
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements[subId], subId);
 
 	map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
@@ -39,6 +39,11 @@
 #include <memory>
 #include <map>
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
 namespace solidity::evmasm
 {
 
@@ -131,7 +136,9 @@ public:
 
 	/// Modify and return the current assembly such that creation and execution gas usage
 	/// is optimised according to the settings in @a _settings.
-	Assembly& optimise(OptimiserSettings const& _settings);
+	/// If @a _threadPool is given, sub-assemblies are optimised concurrently on it, unless
+	/// they share assemblies. The result does not depend on whether a thread pool is used.
+	Assembly& optimise(OptimiserSettings const& _settings, util::ThreadPool* _threadPool = nullptr);
 
 	/// Modify (if @a _enable is set) and return the current assembly such that creation and
 	/// execution gas usage is optimised. @a _isCreation should be true for the top-level assembly.
@@ -165,7 +172,11 @@ protected:
 	/// Does the same operations as @a optimise, but should only be applied to a sub and
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
-	std::map<u256, u256> optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	std::map<u256, u256> optimiseInternal(
+		OptimiserSettings const& _settings,
+		std::set<size_t> _tagsReferencedFromOutside,
+		util::ThreadPool* _threadPool
+	);
 
 	unsigned bytesRequired(unsigned subTagSize) const;
 
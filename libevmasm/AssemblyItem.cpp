@@ -33,6 +33,8 @@ using namespace solidity::evmasm;
 using namespace solidity::langutil;
 
 static_assert(sizeof(size_t) <= 8, "size_t must be at most 64-bits wide");
+// Assembly items are copied by all optimiser steps, so they should not grow unnoticed.
+static_assert(sizeof(AssemblyItem) <= 144, "AssemblyItem should be at most 144 bytes large");
 
 AssemblyItem AssemblyItem::toSubAssemblyTag(size_t _subId) const
 {
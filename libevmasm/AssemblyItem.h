@@ -59,7 +59,7 @@ using AssemblyItems = std::vector<AssemblyItem>;
 class AssemblyItem
 {
 public:
-	enum class JumpType { Ordinary, IntoFunction, OutOfFunction };
+	enum class JumpType: uint8_t { Ordinary, IntoFunction, OutOfFunction };
 
 	AssemblyItem(u256 _push, langutil::SourceLocation _location = langutil::SourceLocation()):
 		AssemblyItem(Push, std::move(_push), std::move(_location)) { }
@@ -75,12 +75,16 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			m_data = std::move(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
 		m_instruction{},
-		m_verbatimBytecode{{_arguments, _returnVariables, std::move(_verbatimData)}}
+		m_verbatimBytecode{std::make_shared<std::tuple<size_t, size_t, bytes> const>(
+			_arguments,
+			_returnVariables,
+			std::move(_verbatimData)
+		)}
 	{}
 
 	AssemblyItem(AssemblyItem const&) = default;
@@ -100,8 +104,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_data; }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = _data; }
 
 	bytes const& verbatimData() const { assertThrow(m_type == VerbatimBytecode, util::Exception, ""); return std::get<2>(*m_verbatimBytecode); }
 
@@ -163,29 +167,32 @@ public:
 	JumpType getJumpType() const { return m_jumpType; }
 	std::string getJumpTypeAsString() const;
 
-	void setPushedValue(u256 const& _value) const { m_pushedValue = std::make_shared<u256>(_value); }
+	void setPushedValue(u256 const& _value) const { m_pushedValue = std::make_shared<u256 const>(_value); }
 	u256 const* pushedValue() const { return m_pushedValue.get(); }
 
 	std::string toAssemblyText(Assembly const& _assembly) const;
 
 	size_t m_modifierDepth = 0;
 
-	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = std::make_shared<size_t>(_n); }
+	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = _n; }
 
 private:
+	// The data is stored inline and the rarely used members are kept small when unset,
+	// so that copying items (which all optimiser steps do) does not allocate or touch
+	// reference counts in the common case.
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
+	JumpType m_jumpType = JumpType::Ordinary;
+	u256 m_data; ///< Only valid if m_type != Operation
 	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
-	/// return variables and verbatim bytecode.
-	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
+	/// return variables and verbatim bytecode. Immutable, so it can be shared between copies.
+	std::shared_ptr<std::tuple<size_t, size_t, bytes> const> m_verbatimBytecode;
 	langutil::SourceLocation m_location;
-	JumpType m_jumpType = JumpType::Ordinary;
 	/// Pushed value for operations with data to be determined during assembly stage,
-	/// e.g. PushSubSize, PushTag, PushSub, etc.
-	mutable std::shared_ptr<u256> m_pushedValue;
+	/// e.g. PushSubSize, PushTag, PushSub, etc. Only set for few items, so it is kept out of line.
+	mutable std::shared_ptr<u256 const> m_pushedValue;
 	/// Number of PushImmutable's with the same hash. Only used for AssignImmutable.
-	mutable std::shared_ptr<size_t> m_immutableOccurrences;
+	mutable std::optional<size_t> m_immutableOccurrences;
 };
 
 inline size_t bytesRequired(AssemblyItems const& _items, size_t _addressLength)
@@ -25,6 +25,9 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <algorithm>
+#include <optional>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -34,6 +37,9 @@ using namespace solidity::evmasm;
 namespace
 {
 
+/// Size of the largest window of the simple rules below.
+size_t constexpr maxWindowSize = 4;
+
 struct OptimiserState
 {
 	AssemblyItems const& items;
@@ -81,6 +87,8 @@ struct ApplyRule<Method, 1>
 template <class Method, size_t WindowSize>
 struct SimplePeepholeOptimizerMethod
 {
+	static_assert(WindowSize <= maxWindowSize, "");
+
 	static bool apply(OptimiserState& _state)
 	{
 		if (
@@ -379,33 +387,79 @@ void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
 		applyMethods(_state, _other...);
 }
 
-size_t numberOfPops(AssemblyItems const& _items)
+size_t numberOfPops(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
+{
+	return static_cast<size_t>(std::count(_begin, _end, Instruction::POP));
+}
+
+size_t bytesRequired(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
 {
-	return static_cast<size_t>(std::count(_items.begin(), _items.end(), Instruction::POP));
+	size_t size = 0;
+	for (auto it = _begin; it != _end; ++it)
+		size += it->bytesRequired(3);
+	return size;
+}
+
+/// @returns true if replacing the items in the given range by @a _optimisedItems is an improvement.
+bool isImprovement(
+	AssemblyItems::const_iterator _begin,
+	AssemblyItems::const_iterator _end,
+	AssemblyItems const& _optimisedItems
+)
+{
+	size_t const size = static_cast<size_t>(_end - _begin);
+	return _optimisedItems.size() < size || (
+		_optimisedItems.size() == size && (
+			bytesRequired(_optimisedItems.begin(), _optimisedItems.end()) < bytesRequired(_begin, _end) ||
+			numberOfPops(_optimisedItems.begin(), _optimisedItems.end()) > numberOfPops(_begin, _end)
+		)
+	);
 }
 
 }
 
 bool PeepholeOptimiser::optimise()
 {
-	OptimiserState state {m_items, 0, std::back_inserter(m_optimisedItems)};
-	while (state.i < m_items.size())
+	// The previous pass did not apply any rule to the items before m_scanStart and the last
+	// m_unchangedSuffix items. Since the rules only look ahead, this pass would not change them
+	// either and would process them in the same way, so only the items in between are examined.
+	size_t const end = m_items.size() - m_unchangedSuffix;
+	m_optimisedItems.clear();
+	OptimiserState state {m_items, m_scanStart, std::back_inserter(m_optimisedItems)};
+	optional<size_t> firstChange;
+	size_t changeEnd = 0;
+	while (state.i < end)
+	{
+		size_t const position = state.i;
 		applyMethods(
 			state,
 			PushPop(), OpPop(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
 			DupSwap(), IsZeroIsZeroJumpI(), JumpToNext(), UnreachableCode(),
 			TagConjunctions(), TruthyAnd(), Identity()
 		);
-	if (m_optimisedItems.size() < m_items.size() || (
-		m_optimisedItems.size() == m_items.size() && (
-			evmasm::bytesRequired(m_optimisedItems, 3) < evmasm::bytesRequired(m_items, 3) ||
-			numberOfPops(m_optimisedItems) > numberOfPops(m_items)
-		)
-	))
-	{
-		m_items = std::move(m_optimisedItems);
-		return true;
+		// Only the identity consumes a single item.
+		if (state.i > position + 1)
+		{
+			if (!firstChange)
+				firstChange = position;
+			changeEnd = state.i;
+		}
 	}
-	else
+	if (!firstChange)
+		return false;
+
+	// The items outside of the examined range stay the same, so it suffices to compare the range.
+	auto const begin = m_items.begin() + static_cast<ptrdiff_t>(m_scanStart);
+	auto const replacedEnd = m_items.begin() + static_cast<ptrdiff_t>(state.i);
+	if (!isImprovement(begin, replacedEnd, m_optimisedItems))
 		return false;
+
+	// An improvement never increases the number of items, so the result fits into the examined range.
+	m_unchangedSuffix = m_items.size() - changeEnd;
+	m_items.erase(
+		move(m_optimisedItems.begin(), m_optimisedItems.end(), begin),
+		replacedEnd
+	);
+	m_scanStart = *firstChange >= maxWindowSize - 1 ? *firstChange - (maxWindowSize - 1) : 0;
+	return true;
 }
@@ -44,11 +44,20 @@ public:
 	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
 	virtual ~PeepholeOptimiser() = default;
 
+	/// Performs one pass over the items and keeps the result if it is an improvement.
+	/// Later passes skip the leading and trailing items the previous one did not change, so the
+	/// items must not be modified by anything else between calls. This does not reduce the number
+	/// of passes needed to reach a fixed point, each of which can still examine most of the items.
+	/// @returns true if the items were changed.
 	bool optimise();
 
 private:
 	AssemblyItems& m_items;
 	AssemblyItems m_optimisedItems;
+	/// Position where the next pass starts examining the items.
+	size_t m_scanStart = 0;
+	/// Number of items at the end that the next pass does not need to examine.
+	size_t m_unchangedSuffix = 0;
 };
 
 }
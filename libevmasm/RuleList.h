@@ -40,22 +40,9 @@
 namespace solidity::evmasm
 {
 
-template <class S> S divWorkaround(S const& _a, S const& _b)
-{
-	return (S)(bigint(_a) / bigint(_b));
-}
-
-template <class S> S modWorkaround(S const& _a, S const& _b)
-{
-	return (S)(bigint(_a) % bigint(_b));
-}
-
-// This works around a bug fixed with Boost 1.64.
-// https://www.boost.org/doc/libs/1_68_0/libs/multiprecision/doc/html/boost_multiprecision/map/hist.html#boost_multiprecision.map.hist.multiprecision_2_3_1_boost_1_64
-template <class S> S shlWorkaround(S const& _x, unsigned _amount)
-{
-	return u256((bigint(_x) << _amount) & u256(-1));
-}
+/// Fixed-width type that can hold the intermediate results of ADDMOD and MULMOD.
+/// Unlike bigint, it never allocates.
+using u512 = boost::multiprecision::number<boost::multiprecision::cpp_int_backend<512, 512, boost::multiprecision::unsigned_magnitude, boost::multiprecision::unchecked, void>>;
 
 /// @returns k if _x == 2**k, nullopt otherwise
 inline std::optional<size_t> binaryLogarithm(u256 const& _x)
@@ -85,11 +72,11 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 		{Builtins::ADD(A, B), [=]{ return A.d() + B.d(); }},
 		{Builtins::MUL(A, B), [=]{ return A.d() * B.d(); }},
 		{Builtins::SUB(A, B), [=]{ return A.d() - B.d(); }},
-		{Builtins::DIV(A, B), [=]{ return B.d() == 0 ? 0 : divWorkaround(A.d(), B.d()); }},
-		{Builtins::SDIV(A, B), [=]{ return B.d() == 0 ? 0 : s2u(divWorkaround(u2s(A.d()), u2s(B.d()))); }},
-		{Builtins::MOD(A, B), [=]{ return B.d() == 0 ? 0 : modWorkaround(A.d(), B.d()); }},
-		{Builtins::SMOD(A, B), [=]{ return B.d() == 0 ? 0 : s2u(modWorkaround(u2s(A.d()), u2s(B.d()))); }},
-		{Builtins::EXP(A, B), [=]{ return Word(boost::multiprecision::powm(bigint(A.d()), bigint(B.d()), bigint(1) << Pattern::WordSize)); }},
+		{Builtins::DIV(A, B), [=]{ return B.d() == 0 ? 0 : Word(A.d() / B.d()); }},
+		{Builtins::SDIV(A, B), [=]{ return B.d() == 0 ? 0 : s2u(u2s(A.d()) / u2s(B.d())); }},
+		{Builtins::MOD(A, B), [=]{ return B.d() == 0 ? 0 : Word(A.d() % B.d()); }},
+		{Builtins::SMOD(A, B), [=]{ return B.d() == 0 ? 0 : s2u(u2s(A.d()) % u2s(B.d())); }},
+		{Builtins::EXP(A, B), [=]{ return exp256(A.d(), B.d()); }},
 		{Builtins::NOT(A), [=]{ return ~A.d(); }},
 		{Builtins::LT(A, B), [=]() -> Word { return A.d() < B.d() ? 1 : 0; }},
 		{Builtins::GT(A, B), [=]() -> Word { return A.d() > B.d() ? 1 : 0; }},
@@ -106,8 +93,8 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 				0 :
 				(B.d() >> unsigned(8 * (Pattern::WordSize / 8 - 1 - A.d()))) & 0xff;
 		}},
-		{Builtins::ADDMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((bigint(A.d()) + bigint(B.d())) % C.d()); }},
-		{Builtins::MULMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((bigint(A.d()) * bigint(B.d())) % C.d()); }},
+		{Builtins::ADDMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((u512(A.d()) + u512(B.d())) % u512(C.d())); }},
+		{Builtins::MULMOD(A, B, C), [=]{ return C.d() == 0 ? 0 : Word((u512(A.d()) * u512(B.d())) % u512(C.d())); }},
 		{Builtins::SIGNEXTEND(A, B), [=]() -> Word {
 			if (A.d() >= Pattern::WordSize / 8 - 1)
 				return B.d();
@@ -118,7 +105,7 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 		{Builtins::SHL(A, B), [=]{
 			if (A.d() >= Pattern::WordSize)
 				return Word(0);
-			return shlWorkaround(B.d(), unsigned(A.d()));
+			return B.d() << unsigned(A.d());
 		}},
 		{Builtins::SHR(A, B), [=]{
 			if (A.d() >= Pattern::WordSize)
@@ -436,11 +423,11 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHL(B, SHL(A, X)) -> SHL(min(A+B, 256), X)
 		Builtins::SHL(B, Builtins::SHL(A, X)),
 		[=]() -> Pattern {
-			bigint sum = bigint(A.d()) + B.d();
-			if (sum >= Pattern::WordSize)
+			// A + B may overflow, so compare without computing the sum first.
+			if (A.d() >= Pattern::WordSize || B.d() >= Pattern::WordSize - A.d())
 				return Builtins::AND(X, Word(0));
 			else
-				return Builtins::SHL(Word(sum), X);
+				return Builtins::SHL(A.d() + B.d(), X);
 		}
 	});
 
@@ -449,11 +436,11 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHR(B, SHR(A, X)) -> SHR(min(A+B, 256), X)
 		Builtins::SHR(B, Builtins::SHR(A, X)),
 		[=]() -> Pattern {
-			bigint sum = bigint(A.d()) + B.d();
-			if (sum >= Pattern::WordSize)
+			// A + B may overflow, so compare without computing the sum first.
+			if (A.d() >= Pattern::WordSize || B.d() >= Pattern::WordSize - A.d())
 				return Builtins::AND(X, Word(0));
 			else
-				return Builtins::SHR(Word(sum), X);
+				return Builtins::SHR(A.d() + B.d(), X);
 		}
 	});
 
@@ -462,7 +449,7 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHR(B, SHL(A, X)) -> AND(SH[L/R]([B - A / A - B], X), Mask)
 		Builtins::SHR(B, Builtins::SHL(A, X)),
 		[=]() -> Pattern {
-			Word mask = shlWorkaround(~Word(0), unsigned(A.d())) >> unsigned(B.d());
+			Word mask = (~Word(0) << unsigned(A.d())) >> unsigned(B.d());
 
 			if (A.d() > B.d())
 				return Builtins::AND(Builtins::SHL(A.d() - B.d(), X), mask);
@@ -479,7 +466,7 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		// SHL(B, SHR(A, X)) -> AND(SH[L/R]([B - A / A - B], X), Mask)
 		Builtins::SHL(B, Builtins::SHR(A, X)),
 		[=]() -> Pattern {
-			Word mask = shlWorkaround((~Word(0)) >> unsigned(A.d()), unsigned(B.d()));
+			Word mask = ((~Word(0)) >> unsigned(A.d())) << unsigned(B.d());
 
 			if (A.d() > B.d())
 				return Builtins::AND(Builtins::SHR(A.d() - B.d(), X), mask);
@@ -498,7 +485,7 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart7(
 		auto replacement = [=]() -> Pattern {
 			Word mask =
 				instr == Instruction::SHL ?
-				shlWorkaround(A.d(), unsigned(B.d())) :
+				A.d() << unsigned(B.d()) :
 				A.d() >> unsigned(B.d());
 			return Builtins::AND(shiftOp(B.d(), X), std::move(mask));
 		};
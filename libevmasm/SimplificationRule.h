@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <libevmasm/Exceptions.h>
 #include <libevmasm/Instruction.h>
+#include <libsolutil/Assertions.h>
 #include <libsolutil/CommonData.h>
+#include <array>
 #include <functional>
 
 namespace solidity::evmasm
@@ -51,6 +54,34 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * Expressions matched by the match groups of a pattern. Match groups are numbered
+ * from 1, group 0 means that a pattern is not part of a match group.
+ * Has a fixed size so that resetting it between attempts to match a rule does not allocate.
+ */
+template <class Expression>
+class MatchGroups
+{
+public:
+	static constexpr unsigned maxGroup = 7;
+
+	/// @returns the expression matched by @a _group or nullptr if it is not matched yet.
+	Expression const*& operator[](unsigned _group)
+	{
+		assertThrow(0 < _group && _group <= maxGroup, OptimizerException, "Invalid match group.");
+		return m_expressions[_group];
+	}
+	Expression const* operator[](unsigned _group) const
+	{
+		assertThrow(0 < _group && _group <= maxGroup, OptimizerException, "Invalid match group.");
+		return m_expressions[_group];
+	}
+	void clear() { m_expressions.fill(nullptr); }
+
+private:
+	std::array<Expression const*, maxGroup + 1> m_expressions{};
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
@@ -45,8 +45,19 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	resetMatchGroups();
 
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+	vector<SimplificationRule<Pattern>> const& candidates = m_rules[uint8_t(_expr.item->instruction())];
+	if (candidates.empty())
+		return nullptr;
+
+	// Look up the representatives of the arguments only once instead of for every rule.
+	m_argumentItems.clear();
+	for (ExpressionClasses::Id argument: _expr.arguments)
+		m_argumentItems.push_back(_classes.representative(argument).item);
+
+	for (auto const& rule: candidates)
 	{
+		if (!argumentsMayMatch(rule))
+			continue;
 		if (rule.pattern.matches(_expr, _classes))
 			if (!rule.feasible || rule.feasible())
 				return &rule;
@@ -56,6 +67,16 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	return nullptr;
 }
 
+bool Rules::argumentsMayMatch(SimplificationRule<Pattern> const& _rule) const
+{
+	vector<Pattern> const& argumentPatterns = _rule.pattern.arguments();
+	assertThrow(argumentPatterns.empty() || argumentPatterns.size() == m_argumentItems.size(), OptimizerException, "");
+	for (size_t i = 0; i < argumentPatterns.size(); ++i)
+		if (!argumentPatterns[i].matchesBaseItem(m_argumentItems[i]))
+			return false;
+	return true;
+}
+
 bool Rules::isInitialized() const
 {
 	return !m_rules[uint8_t(Instruction::ADD)].empty();
@@ -103,7 +124,7 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, MatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -115,9 +136,10 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
+		Expression const*& matchedExpression = (*m_matchGroups)[m_matchGroup];
+		if (!matchedExpression)
+			matchedExpression = &_expr;
+		else if (matchedExpression->id != _expr.id)
 			return false;
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
@@ -189,8 +211,9 @@ Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
 	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* matchedExpression = (*m_matchGroups)[m_matchGroup];
+	assertThrow(matchedExpression, OptimizerException, "");
+	return *matchedExpression;
 }
 
 u256 const& Pattern::data() const
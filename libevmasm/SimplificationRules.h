@@ -73,10 +73,16 @@ private:
 
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
+	/// @returns false if the argument patterns of @a _rule cannot match the items of the
+	/// arguments in m_argumentItems, without trying the recursive match.
+	bool argumentsMayMatch(SimplificationRule<Pattern> const& _rule) const;
+
+	MatchGroups<Expression> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	/// Buffer for the items of the representatives of the arguments of the expression to simplify.
+	std::vector<AssemblyItem const*> m_argumentItems;
 };
 
 /**
@@ -107,12 +113,14 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, MatchGroups<Expression>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
+	/// @returns true if @a _item matches this pattern, ignoring arguments and match groups.
+	bool matchesBaseItem(AssemblyItem const* _item) const;
 
 	AssemblyItem toAssemblyItem(langutil::SourceLocation const& _location) const;
-	std::vector<Pattern> arguments() const { return m_arguments; }
+	std::vector<Pattern> const& arguments() const { return m_arguments; }
 
 	/// @returns the id of the matched expression if this pattern is part of a match group.
 	Id id() const { return matchGroupValue().id; }
@@ -129,7 +137,6 @@ public:
 	}
 
 private:
-	bool matchesBaseItem(AssemblyItem const* _item) const;
 	Expression const& matchGroupValue() const;
 	u256 const& data() const;
 
@@ -139,7 +146,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	MatchGroups<Expression>* m_matchGroups = nullptr;
 };
 
 /**
@@ -53,6 +53,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
@@ -88,11 +90,9 @@ string CharStream::lineAtPosition(int _position) const
 	size_type searchStart = min<size_type>(m_source.size(), size_type(_position));
 	if (searchStart > 0)
 		searchStart--;
-	size_type lineStart = m_source.rfind('\n', searchStart);
-	if (lineStart == string::npos)
-		lineStart = 0;
-	else
-		lineStart++;
+	// The line starts right after the last newline at or before searchStart.
+	vector<size_t> const& starts = lineStarts();
+	size_type lineStart = *prev(upper_bound(starts.begin(), starts.end(), searchStart + 1));
 	string line = m_source.substr(
 		lineStart,
 		min(m_source.find('\n', lineStart), m_source.size()) - lineStart
@@ -105,16 +105,39 @@ string CharStream::lineAtPosition(int _position) const
 tuple<int, int> CharStream::translatePositionToLineColumn(int _position) const
 {
 	using size_type = string::size_type;
-	using diff_type = string::difference_type;
 	size_type searchPosition = min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	vector<size_t> const& starts = lineStarts();
+	auto lineStart = prev(upper_bound(starts.begin(), starts.end(), searchPosition));
+	return tuple<int, int>(
+		static_cast<int>(lineStart - starts.begin()),
+		static_cast<int>(searchPosition - *lineStart)
+	);
+}
+
+vector<tuple<int, int>> CharStream::translatePositionsToLineColumns(vector<int> const& _positions) const
+{
+	vector<tuple<int, int>> result;
+	result.reserve(_positions.size());
+	for (int position: _positions)
+		result.emplace_back(translatePositionToLineColumn(position));
+	return result;
+}
+
+vector<size_t> const& CharStream::lineStarts() const
+{
+	shared_ptr<vector<size_t> const> starts = atomic_load(&m_lineStarts);
+	if (!starts)
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == string::npos ? 0 : lineStart + 1;
+		auto newStarts = make_shared<vector<size_t>>();
+		newStarts->push_back(0);
+		for (size_t position = m_source.find('\n'); position != string::npos; position = m_source.find('\n', position + 1))
+			newStarts->push_back(position + 1);
+		starts = move(newStarts);
+		// Streams can be shared between threads. If another thread was faster, use its index,
+		// so that references returned earlier stay valid.
+		shared_ptr<vector<size_t> const> expected;
+		if (!atomic_compare_exchange_strong(&m_lineStarts, &expected, starts))
+			starts = move(expected);
 	}
-	return tuple<int, int>(lineNumber, searchPosition - lineStart);
+	return *starts;
 }
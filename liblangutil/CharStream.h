@@ -53,9 +53,11 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -92,10 +94,18 @@ public:
 
 	///@{
 	///@name Error printing helper functions
-	/// Functions that help pretty-printing parse errors
-	/// Do only use in error cases, they are quite expensive.
+	/// Functions that help pretty-printing parse errors and translating source locations.
+	/// They use the index of line starts, which is built on first use.
 	std::string lineAtPosition(int _position) const;
+	/// @returns the zero-based line and column of @a _position. Positions past the end
+	/// of the source are treated as the end of the source.
 	std::tuple<int, int> translatePositionToLineColumn(int _position) const;
+	/// Translates all of @a _positions, see translatePositionToLineColumn.
+	std::vector<std::tuple<int, int>> translatePositionsToLineColumns(std::vector<int> const& _positions) const;
+	/// @returns the offsets at which the lines of the source start, in increasing order.
+	/// The first line always starts at offset zero, every other one right after a newline.
+	/// The reference stays valid as long as the stream exists.
+	std::vector<size_t> const& lineStarts() const;
 	///@}
 
 	/// Tests whether or not given octet sequence is present at the current position in stream.
@@ -116,6 +126,9 @@ private:
 	std::string m_source;
 	std::string m_name;
 	size_t m_position{0};
+	/// Index of line starts, see lineStarts(). It is set only once and can be shared
+	/// by copies of the stream, since the source cannot change.
+	mutable std::shared_ptr<std::vector<size_t> const> m_lineStarts;
 };
 
 }
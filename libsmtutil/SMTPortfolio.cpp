@@ -26,6 +26,13 @@
 #endif
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -36,9 +43,13 @@ SMTPortfolio::SMTPortfolio(
 	map<h256, string> _smtlib2Responses,
 	frontend::ReadCallback::Callback _smtCallback,
 	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
-	optional<unsigned> _queryTimeout
+	optional<unsigned> _queryTimeout,
+	bool _raceSolvers
 ):
-	SolverInterface(_queryTimeout)
+	SolverInterface(_queryTimeout),
+	m_enabledSolvers(_enabledSolvers),
+	m_raceSolvers(_raceSolvers),
+	m_answersSMTLib2Queries(!_smtlib2Responses.empty() || _smtCallback)
 {
 	m_solvers.emplace_back(make_unique<SMTLib2Interface>(move(_smtlib2Responses), move(_smtCallback), m_queryTimeout));
 #ifdef HAVE_Z3
@@ -51,10 +62,24 @@ SMTPortfolio::SMTPortfolio(
 #endif
 }
 
+SMTPortfolio::SMTPortfolio(
+	vector<unique_ptr<SolverInterface>> _solvers,
+	optional<unsigned> _queryTimeout,
+	bool _raceSolvers
+):
+	SolverInterface(_queryTimeout),
+	m_solvers(move(_solvers)),
+	m_enabledSolvers(SMTSolverChoice::None()),
+	m_raceSolvers(_raceSolvers)
+{
+	smtAssert(!m_solvers.empty(), "");
+}
+
 void SMTPortfolio::reset()
 {
 	for (auto const& s: m_solvers)
 		s->reset();
+	m_declarations.clear();
 }
 
 void SMTPortfolio::push()
@@ -72,6 +97,7 @@ void SMTPortfolio::pop()
 void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort)
 {
 	smtAssert(_sort, "");
+	m_declarations[_name] = _sort;
 	for (auto const& s: m_solvers)
 		s->declareVariable(_name, _sort);
 }
@@ -111,33 +137,141 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * When racing, solvers that are interrupted report UNKNOWN, so the result is the answer
+ * of the first solver to answer, unless another solver answered differently before it
+ * could be interrupted. The results are merged in the order of the solvers, so if several
+ * solvers answered, the model is always taken from the same one.
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
 {
-	CheckResult lastResult = CheckResult::ERROR;
-	vector<string> finalValues;
-	for (auto const& s: m_solvers)
+	Result merged{CheckResult::ERROR, {}};
+	if (m_raceSolvers && m_solvers.size() > 1)
 	{
-		CheckResult result;
-		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
-		if (solverAnswered(result))
-		{
-			if (!solverAnswered(lastResult))
-			{
-				lastResult = result;
-				finalValues = std::move(values);
-			}
-			else if (lastResult != result)
-			{
-				lastResult = CheckResult::CONFLICTING;
+		for (Result& result: raceSolvers(_expressionsToEvaluate))
+			if (!mergeResult(merged, move(result)))
 				break;
-			}
-		}
-		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
+	}
+	else
+		for (auto const& s: m_solvers)
+			if (!mergeResult(merged, s->check(_expressionsToEvaluate)))
+				break;
+	return merged;
+}
+
+unique_ptr<SMTPortfolio> SMTPortfolio::copy(vector<Expression> const& _expressions) const
+{
+	set<string> symbols;
+	vector<Expression const*> toVisit;
+	for (Expression const& expression: _expressions)
+		toVisit.push_back(&expression);
+	while (!toVisit.empty())
+	{
+		Expression const* expression = toVisit.back();
+		toVisit.pop_back();
+		if (m_declarations.count(expression->name))
+			symbols.insert(expression->name);
+		for (Expression const& argument: expression->arguments)
+			toVisit.push_back(&argument);
+	}
+
+	// Without responses or a callback, the SMT-LIB2 interface cannot answer any query.
+	vector<unique_ptr<SolverInterface>> solvers;
+#ifdef HAVE_Z3
+	if (m_enabledSolvers.z3 && Z3Interface::available())
+		solvers.emplace_back(make_unique<Z3Interface>(m_queryTimeout));
+#endif
+#ifdef HAVE_CVC4
+	if (m_enabledSolvers.cvc4)
+		solvers.emplace_back(make_unique<CVC4Interface>(m_queryTimeout));
+#endif
+	smtAssert(!solvers.empty(), "Copying a portfolio requires Z3 or CVC4.");
+	auto result = make_unique<SMTPortfolio>(move(solvers), m_queryTimeout, m_raceSolvers);
+	for (string const& symbol: symbols)
+		result->declareVariable(symbol, m_declarations.at(symbol));
+	return result;
+}
+
+bool SMTPortfolio::mergeResult(Result& _merged, Result _result)
+{
+	auto& [lastResult, finalValues] = _merged;
+	auto& [result, values] = _result;
+	if (solverAnswered(result))
+	{
+		if (!solverAnswered(lastResult))
+		{
 			lastResult = result;
+			finalValues = std::move(values);
+		}
+		else if (lastResult != result)
+		{
+			lastResult = CheckResult::CONFLICTING;
+			return false;
+		}
 	}
-	return make_pair(lastResult, finalValues);
+	else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
+		lastResult = result;
+	return true;
+}
+
+vector<SMTPortfolio::Result> SMTPortfolio::raceSolvers(vector<Expression> const& _expressionsToEvaluate)
+{
+	vector<Result> results(m_solvers.size(), Result{CheckResult::ERROR, {}});
+	vector<exception_ptr> failures(m_solvers.size());
+	vector<bool> finished(m_solvers.size(), false);
+	bool answered = false;
+	mutex resultMutex;
+	condition_variable solverFinished;
+
+	auto run = [&](size_t _index) {
+		Result result{CheckResult::ERROR, {}};
+		exception_ptr failure;
+		try
+		{
+			result = m_solvers[_index]->check(_expressionsToEvaluate);
+		}
+		catch (...)
+		{
+			failure = current_exception();
+		}
+		lock_guard<mutex> lock(resultMutex);
+		answered = answered || solverAnswered(result.first);
+		results[_index] = move(result);
+		failures[_index] = move(failure);
+		finished[_index] = true;
+		solverFinished.notify_all();
+	};
+
+	// The SMT-LIB2 interface at position 0 may invoke the callback of the host application,
+	// so it stays on the calling thread.
+	bool const firstOnCallingThread = dynamic_cast<SMTLib2Interface*>(m_solvers.front().get());
+	vector<thread> threads;
+	for (size_t index = firstOnCallingThread ? 1 : 0; index < m_solvers.size(); ++index)
+		threads.emplace_back(run, index);
+	if (firstOnCallingThread)
+		run(0);
+
+	{
+		unique_lock<mutex> lock(resultMutex);
+		auto allFinished = [&]() { return find(finished.begin(), finished.end(), false) == finished.end(); };
+		solverFinished.wait(lock, [&]() { return answered || allFinished(); });
+		// An interrupt is lost if it arrives before the solver started checking, so it is
+		// repeated until all solvers have finished.
+		while (!allFinished())
+		{
+			for (size_t index = 0; index < m_solvers.size(); ++index)
+				if (!finished[index])
+					m_solvers[index]->interrupt();
+			solverFinished.wait_for(lock, chrono::milliseconds(10));
+		}
+	}
+	for (thread& solverThread: threads)
+		solverThread.join();
+
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+	return results;
 }
 
 vector<string> SMTPortfolio::unhandledQueries()
@@ -24,6 +24,7 @@
 #include <libsolutil/FixedHash.h>
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace solidity::smtutil
@@ -34,6 +35,10 @@ namespace solidity::smtutil
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ *
+ * If racing is enabled, the solvers check each query concurrently and the remaining
+ * solvers are interrupted as soon as one of them answers, so that a hard query
+ * only takes as long as the fastest solver needs for it.
  */
 class SMTPortfolio: public SolverInterface
 {
@@ -46,7 +51,15 @@ public:
 		std::map<util::h256, std::string> _smtlib2Responses = {},
 		frontend::ReadCallback::Callback _smtCallback = {},
 		SMTSolverChoice _enabledSolvers = SMTSolverChoice::All(),
-		std::optional<unsigned> _queryTimeout = {}
+		std::optional<unsigned> _queryTimeout = {},
+		bool _raceSolvers = false
+	);
+	/// Creates a portfolio of the given solvers.
+	/// copy() and unhandledQueries() require the portfolio to be created by the other constructor.
+	SMTPortfolio(
+		std::vector<std::unique_ptr<SolverInterface>> _solvers,
+		std::optional<unsigned> _queryTimeout = {},
+		bool _raceSolvers = false
 	);
 
 	void reset() override;
@@ -62,10 +75,33 @@ public:
 
 	std::vector<std::string> unhandledQueries() override;
 	size_t solvers() override { return m_solvers.size(); }
+
+	/// @returns true if SMT-LIB2 query responses or a callback were given, which
+	/// copies do not have.
+	bool answersSMTLib2Queries() const { return m_answersSMTLib2Queries; }
+	/// @returns a new portfolio with the same settings and the same solvers apart from the
+	/// SMT-LIB2 interface, in which the symbols occurring in @a _expressions are declared.
+	/// Assertions are not transferred. Requires Z3 or CVC4.
+	/// Does not modify this portfolio, so it can be called concurrently to create
+	/// solvers for independent queries.
+	std::unique_ptr<SMTPortfolio> copy(std::vector<Expression> const& _expressions) const;
 private:
+	using Result = std::pair<CheckResult, std::vector<std::string>>;
+
 	static bool solverAnswered(CheckResult result);
+	/// Merges the result @a _result of a single solver into @a _merged.
+	/// @returns false if the solvers gave conflicting answers.
+	static bool mergeResult(Result& _merged, Result _result);
+	/// Runs the query on all solvers concurrently and interrupts the remaining ones
+	/// once a solver answered. @returns the result of each solver.
+	std::vector<Result> raceSolvers(std::vector<Expression> const& _expressionsToEvaluate);
 
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	SMTSolverChoice m_enabledSolvers;
+	bool m_raceSolvers = false;
+	bool m_answersSMTLib2Queries = false;
+	/// Sort of every symbol declared since the last reset.
+	std::map<std::string, SortPointer> m_declarations;
 
 	std::vector<Expression> m_assertions;
 };
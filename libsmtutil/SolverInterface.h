@@ -411,6 +411,11 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a call to check() that is running on another thread to stop as soon as possible,
+	/// in which case it returns UNKNOWN. May be called concurrently with check().
+	/// Does nothing for solvers that cannot be interrupted or if no check is running.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
@@ -27,11 +27,12 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::smtutil;
 
-Z3CHCInterface::Z3CHCInterface(optional<unsigned> _queryTimeout):
+Z3CHCInterface::Z3CHCInterface(optional<unsigned> _queryTimeout, bool _recordClauses):
 	CHCSolverInterface(_queryTimeout),
 	m_z3Interface(make_unique<Z3Interface>(m_queryTimeout)),
 	m_context(m_z3Interface->context()),
-	m_solver(*m_context)
+	m_solver(*m_context),
+	m_recordClauses(_recordClauses)
 {
 	Z3_get_version(
 		&get<0>(m_version),
@@ -40,13 +41,9 @@ Z3CHCInterface::Z3CHCInterface(optional<unsigned> _queryTimeout):
 		&get<3>(m_version)
 	);
 
-	// These need to be set globally.
-	z3::set_param("rewriter.pull_cheap_ite", true);
-
+	Z3Interface::setGlobalParameters(!m_queryTimeout);
 	if (m_queryTimeout)
 		m_context->set("timeout", int(*m_queryTimeout));
-	else
-		z3::set_param("rlimit", Z3Interface::resourceLimit);
 
 	setSpacerOptions();
 }
@@ -59,11 +56,15 @@ void Z3CHCInterface::declareVariable(string const& _name, SortPointer const& _so
 
 void Z3CHCInterface::registerRelation(Expression const& _expr)
 {
+	if (m_recordClauses)
+		m_clauses.push_back({m_z3Interface->declarations().size(), _expr, nullopt});
 	m_solver.register_relation(m_z3Interface->functions().at(_expr.name));
 }
 
 void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
 {
+	if (m_recordClauses)
+		m_clauses.push_back({m_z3Interface->declarations().size(), _expr, _name});
 	z3::expr rule = m_z3Interface->toZ3Expr(_expr);
 	if (m_z3Interface->constants().empty())
 		m_solver.add_rule(rule, m_context->str_symbol(_name.c_str()));
@@ -128,6 +129,26 @@ pair<CheckResult, CHCSolverInterface::CexGraph> Z3CHCInterface::query(Expression
 	return {result, {}};
 }
 
+unique_ptr<Z3CHCInterface> Z3CHCInterface::copy() const
+{
+	smtAssert(m_recordClauses, "");
+	auto result = make_unique<Z3CHCInterface>(m_queryTimeout);
+	auto const& declarations = m_z3Interface->declarations();
+	size_t declared = 0;
+	for (Clause const& clause: m_clauses)
+	{
+		for (; declared < clause.declarationCount; ++declared)
+			result->declareVariable(declarations[declared].first, declarations[declared].second);
+		if (clause.ruleName)
+			result->addRule(clause.expression, *clause.ruleName);
+		else
+			result->registerRelation(clause.expression);
+	}
+	for (; declared < declarations.size(); ++declared)
+		result->declareVariable(declarations[declared].first, declarations[declared].second);
+	return result;
+}
+
 void Z3CHCInterface::setSpacerOptions(bool _preProcessing)
 {
 	// Spacer options.
@@ -25,7 +25,10 @@
 #include <libsmtutil/CHCSolverInterface.h>
 #include <libsmtutil/Z3Interface.h>
 
+#include <memory>
+#include <optional>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace solidity::smtutil
@@ -34,7 +37,9 @@ namespace solidity::smtutil
 class Z3CHCInterface: public CHCSolverInterface
 {
 public:
-	Z3CHCInterface(std::optional<unsigned> _queryTimeout = {});
+	/// If @a _recordClauses is set, relations and rules are also recorded, so that they can
+	/// be transferred to other solver instances using copy().
+	Z3CHCInterface(std::optional<unsigned> _queryTimeout = {}, bool _recordClauses = false);
 
 	/// Forwards variable declaration to Z3Interface.
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
@@ -49,7 +54,24 @@ public:
 
 	void setSpacerOptions(bool _preProcessing = true);
 
+	/// @returns the number of relations and rules registered so far, which is only
+	/// available if clauses are recorded.
+	size_t clauseCount() const { return m_clauses.size(); }
+	/// @returns a new solver with its own Z3 context that contains all relations, rules and
+	/// declarations of this one. Since this solver is not modified, several copies can be
+	/// created and queried concurrently.
+	std::unique_ptr<Z3CHCInterface> copy() const;
+
 private:
+	/// A relation (if @a ruleName is not set) or a rule, together with the number of
+	/// declarations made before it.
+	struct Clause
+	{
+		size_t declarationCount;
+		Expression expression;
+		std::optional<std::string> ruleName;
+	};
+
 	/// Constructs a nonlinear counterexample graph from the refutation.
 	CHCSolverInterface::CexGraph cexGraph(z3::expr const& _proof);
 	/// @returns the fact from a proof node.
@@ -67,6 +89,9 @@ private:
 	z3::fixedpoint m_solver;
 
 	std::tuple<unsigned, unsigned, unsigned, unsigned> m_version = std::tuple(0, 0, 0, 0);
+
+	bool m_recordClauses = false;
+	std::vector<Clause> m_clauses;
 };
 
 }
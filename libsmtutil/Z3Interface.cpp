@@ -25,6 +25,8 @@
 #include <libsmtutil/Z3Loader.h>
 #endif
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity::smtutil;
 using namespace solidity::util;
@@ -42,19 +44,25 @@ Z3Interface::Z3Interface(std::optional<unsigned> _queryTimeout):
 	SolverInterface(_queryTimeout),
 	m_solver(m_context)
 {
-	// These need to be set globally.
-	z3::set_param("rewriter.pull_cheap_ite", true);
-
+	setGlobalParameters(!m_queryTimeout);
 	if (m_queryTimeout)
 		m_context.set("timeout", int(*m_queryTimeout));
-	else
-		z3::set_param("rlimit", resourceLimit);
+}
+
+void Z3Interface::setGlobalParameters(bool _resourceLimit)
+{
+	static once_flag pullCheapIte;
+	static once_flag rlimit;
+	call_once(pullCheapIte, []() { z3::set_param("rewriter.pull_cheap_ite", true); });
+	if (_resourceLimit)
+		call_once(rlimit, []() { z3::set_param("rlimit", resourceLimit); });
 }
 
 void Z3Interface::reset()
 {
 	m_constants.clear();
 	m_functions.clear();
+	m_declarations.clear();
 	m_solver.reset();
 }
 
@@ -71,6 +79,7 @@ void Z3Interface::pop()
 void Z3Interface::declareVariable(string const& _name, SortPointer const& _sort)
 {
 	smtAssert(_sort, "");
+	m_declarations.emplace_back(_name, _sort);
 	if (_sort->kind == Kind::Function)
 		declareFunction(_name, *_sort);
 	else if (m_constants.count(_name))
@@ -139,6 +148,12 @@ pair<CheckResult, vector<string>> Z3Interface::check(vector<Expression> const& _
 	return make_pair(result, values);
 }
 
+void Z3Interface::interrupt()
+{
+	// A running check returns unknown (or throws "canceled"), which is reported as UNKNOWN.
+	m_context.interrupt();
+}
+
 z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
 {
 	if (_expr.arguments.empty() && m_constants.count(_expr.name))
@@ -34,6 +34,11 @@ public:
 	Z3Interface(std::optional<unsigned> _queryTimeout = {});
 
 	static bool available();
+	/// Sets the parameters that Z3 only supports globally. Each parameter is set only once,
+	/// by the first solver that needs it. Changing them is not safe while solvers are created
+	/// on other threads, so a solver with the same settings has to be created before
+	/// solvers are created concurrently.
+	static void setGlobalParameters(bool _resourceLimit);
 
 	void reset() override;
 
@@ -44,12 +49,15 @@ public:
 
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override;
 
 	z3::expr toZ3Expr(Expression const& _expr);
 	smtutil::Expression fromZ3Expr(z3::expr const& _expr);
 
 	std::map<std::string, z3::expr> constants() const { return m_constants; }
 	std::map<std::string, z3::func_decl> functions() const { return m_functions; }
+	/// @returns all declarations since the last reset, in the order in which they were made.
+	std::vector<std::pair<std::string, SortPointer>> const& declarations() const { return m_declarations; }
 
 	z3::context* context() { return &m_context; }
 
@@ -70,6 +78,7 @@ private:
 
 	std::map<std::string, z3::expr> m_constants;
 	std::map<std::string, z3::func_decl> m_functions;
+	std::vector<std::pair<std::string, SortPointer>> m_declarations;
 };
 
 }
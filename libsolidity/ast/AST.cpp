@@ -31,6 +31,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <atomic>
 #include <functional>
 #include <utility>
 
@@ -38,8 +39,14 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
 
+namespace
+{
+atomic<uint64_t> nextUniqueNodeKey{0};
+}
+
 ASTNode::ASTNode(int64_t _id, SourceLocation _location):
 	m_id(static_cast<size_t>(_id)),
+	m_uniqueKey(nextUniqueNodeKey.fetch_add(1, memory_order_relaxed)),
 	m_location(std::move(_location))
 {
 }
@@ -79,6 +79,9 @@ public:
 
 	/// @returns an identifier of this AST node that is unique for a single compilation run.
 	int64_t id() const { return int64_t(m_id); }
+	/// @returns a key that identifies this AST node among all nodes ever created by this process.
+	/// Unlike id() and the address of the node, it is not reused by the nodes of a later AST.
+	uint64_t uniqueKey() const { return m_uniqueKey; }
 
 	virtual void accept(ASTVisitor& _visitor) = 0;
 	virtual void accept(ASTConstVisitor& _visitor) const = 0;
@@ -132,6 +135,7 @@ protected:
 	}
 
 private:
+	uint64_t const m_uniqueKey;
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
 	mutable std::unique_ptr<ASTAnnotation> m_annotation;
 	SourceLocation m_location;
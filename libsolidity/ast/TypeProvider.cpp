@@ -191,10 +191,33 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
-	instance().m_generalTypes.clear();
-	instance().m_stringLiteralTypes.clear();
-	instance().m_ufixedMxN.clear();
-	instance().m_fixedMxN.clear();
+	TypeProvider& provider = instance();
+	provider.m_byteArrays.clear();
+	provider.m_dynamicArrays.clear();
+	provider.m_staticArrays.clear();
+	provider.m_arraySlices.clear();
+	provider.m_structTypes.clear();
+	provider.m_storageReferences.clear();
+	provider.m_locationCopies.clear();
+	provider.m_tuples.clear();
+	provider.m_mappings.clear();
+	provider.m_typeTypes.clear();
+	provider.m_metaTypes.clear();
+	provider.m_rationalNumbers.clear();
+	provider.m_contracts.clear();
+	provider.m_enums.clear();
+	provider.m_modules.clear();
+	provider.m_modifiers.clear();
+	provider.m_functionsOfDefinitions.clear();
+	provider.m_functionsOfDeclarations.clear();
+	provider.m_functionsOfTypeNames.clear();
+	provider.m_functionsOfTypeStrings.clear();
+	provider.m_functions.clear();
+
+	provider.m_generalTypes.clear();
+	provider.m_stringLiteralTypes.clear();
+	provider.m_ufixedMxN.clear();
+	provider.m_fixedMxN.clear();
 }
 
 template <typename T, typename... Args>
@@ -204,6 +227,16 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createOrGet(map<Key, T const*>& _cache, Key _key, Args&& ... _args)
+{
+	if (auto it = _cache.find(_key); it != _cache.end())
+		return it->second;
+	// Creating the type can request other types, so the cache is only modified afterwards.
+	T const* type = createAndGet<T>(std::forward<Args>(_args)...);
+	return _cache.emplace(std::move(_key), type).first->second;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -404,7 +437,8 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	auto key = members;
+	return createOrGet(instance().m_tuples, move(key), move(members));
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,33 +446,63 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	TypeProvider& provider = instance();
+	if (_location == DataLocation::Storage && !_isPointer)
+	{
+		// Storage references are derived from the storage pointer, so that every
+		// original type maps to the same reference type.
+		ReferenceType const* pointerType = withLocation(_type, _location, true);
+		if (auto it = provider.m_storageReferences.find(pointerType); it != provider.m_storageReferences.end())
+			return it->second;
+		provider.m_generalTypes.emplace_back(pointerType->copyForLocation(_location, false));
+		auto type = static_cast<ReferenceType const*>(provider.m_generalTypes.back().get());
+		return provider.m_storageReferences.emplace(pointerType, type).first->second;
+	}
+
+	// Copies of arrays and structs are the same types as the ones created directly.
+	if (auto arrayType = dynamic_cast<ArrayType const*>(_type))
+	{
+		if (arrayType->isByteArray())
+			return array(_location, arrayType->isString());
+		else if (arrayType->isDynamicallySized())
+			return array(_location, arrayType->baseType());
+		else
+			return array(_location, arrayType->baseType(), arrayType->length());
+	}
+	if (auto structType = dynamic_cast<StructType const*>(_type))
+		return TypeProvider::structType(structType->structDefinition(), _location);
+
+	auto key = make_tuple(_type, _location, _isPointer);
+	if (auto it = provider.m_locationCopies.find(key); it != provider.m_locationCopies.end())
+		return it->second;
+	provider.m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
+	auto type = static_cast<ReferenceType const*>(provider.m_generalTypes.back().get());
+	return provider.m_locationCopies.emplace(key, type).first->second;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
 {
-	return createAndGet<FunctionType>(_function, _kind);
+	return createOrGet(instance().m_functionsOfDefinitions, make_tuple(_function.uniqueKey(), _kind), _function, _kind);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return createOrGet(instance().m_functionsOfDeclarations, _varDecl.uniqueKey(), _varDecl);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createOrGet(instance().m_functionsOfDeclarations, _def.uniqueKey(), _def);
 }
 
 FunctionType const* TypeProvider::function(ErrorDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createOrGet(instance().m_functionsOfDeclarations, _def.uniqueKey(), _def);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return createOrGet(instance().m_functionsOfTypeNames, _typeName.uniqueKey(), _typeName);
 }
 
 FunctionType const* TypeProvider::function(
@@ -449,7 +513,9 @@ FunctionType const* TypeProvider::function(
 	StateMutability _stateMutability
 )
 {
-	return createAndGet<FunctionType>(
+	return createOrGet(
+		instance().m_functionsOfTypeStrings,
+		make_tuple(_parameterTypes, _returnParameterTypes, _kind, _arbitraryParameters, _stateMutability),
 		_parameterTypes, _returnParameterTypes,
 		_kind, _arbitraryParameters, _stateMutability
 	);
@@ -470,7 +536,22 @@ FunctionType const* TypeProvider::function(
 	bool _saltSet
 )
 {
-	return createAndGet<FunctionType>(
+	return createOrGet(
+		instance().m_functions,
+		make_tuple(
+			_parameterTypes,
+			_returnParameterTypes,
+			_parameterNames,
+			_returnParameterNames,
+			_kind,
+			_arbitraryParameters,
+			_stateMutability,
+			_declaration ? optional<uint64_t>(_declaration->uniqueKey()) : nullopt,
+			_gasSet,
+			_valueSet,
+			_bound,
+			_saltSet
+		),
 		_parameterTypes,
 		_returnParameterTypes,
 		_parameterNames,
@@ -488,7 +569,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createOrGet(instance().m_rationalNumbers, make_tuple(_value, _compatibleBytesType), _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -506,53 +587,58 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 			return bytesStorage();
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
+		if (_location == DataLocation::CallData)
+			return bytesCalldata();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createOrGet(instance().m_byteArrays, make_tuple(_location, _isString), _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	// The constructor converts the base type anyway, converting it here avoids duplicates.
+	_baseType = withLocationIfReference(_location, _baseType);
+	return createOrGet(instance().m_dynamicArrays, make_tuple(_location, _baseType), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	_baseType = withLocationIfReference(_location, _baseType);
+	return createOrGet(instance().m_staticArrays, make_tuple(_location, _baseType, _length), _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createOrGet(instance().m_arraySlices, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createOrGet(instance().m_contracts, make_tuple(_contractDef.uniqueKey(), _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createOrGet(instance().m_enums, _enumDef.uniqueKey(), _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createOrGet(instance().m_modules, _source.uniqueKey(), _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createOrGet(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createOrGet(instance().m_structTypes, make_tuple(_struct.uniqueKey(), _location), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return createOrGet(instance().m_modifiers, _def.uniqueKey(), _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -570,10 +656,10 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return createOrGet(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return createOrGet(instance().m_mappings, make_tuple(_keyType, _valueType), _keyType, _valueType);
 }
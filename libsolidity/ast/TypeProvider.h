@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
 
 namespace solidity::frontend
@@ -37,6 +38,10 @@ namespace solidity::frontend
  *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
+ *
+ * Types are hash-consed: requesting a type with the same arguments twice returns the same
+ * object, and reference types that only differ in how they were obtained (directly or via
+ * @ref withLocation) are shared as well.
  */
 class TypeProvider
 {
@@ -212,6 +217,11 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// @returns the type stored under @a _key in @a _cache, creating it from @a _args if
+	/// it does not exist yet.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createOrGet(std::map<Key, T const*>& _cache, Key _key, Args&& ... _args);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -234,6 +244,42 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Lookup tables for the types owned by m_generalTypes, keyed by the arguments they were created from.
+	/// AST nodes are identified by ASTNode::uniqueKey() instead of their address, which can be reused
+	/// by the nodes of a later AST.
+	std::map<std::tuple<DataLocation, bool>, ArrayType const*> m_byteArrays{};
+	std::map<std::tuple<DataLocation, Type const*>, ArrayType const*> m_dynamicArrays{};
+	std::map<std::tuple<DataLocation, Type const*, u256>, ArrayType const*> m_staticArrays{};
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySlices{};
+	std::map<std::tuple<uint64_t, DataLocation>, StructType const*> m_structTypes{};
+	/// Storage references (i.e. non-pointers), keyed by the corresponding storage pointer type.
+	std::map<ReferenceType const*, ReferenceType const*> m_storageReferences{};
+	/// Copies of reference types other than arrays and structs, keyed by original, location and pointer flag.
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, ReferenceType const*> m_locationCopies{};
+	std::map<std::vector<Type const*>, TupleType const*> m_tuples{};
+	std::map<std::tuple<Type const*, Type const*>, MappingType const*> m_mappings{};
+	std::map<Type const*, TypeType const*> m_typeTypes{};
+	std::map<Type const*, MagicType const*> m_metaTypes{};
+	std::map<std::tuple<rational, Type const*>, RationalNumberType const*> m_rationalNumbers{};
+	std::map<std::tuple<uint64_t, bool>, ContractType const*> m_contracts{};
+	std::map<uint64_t, EnumType const*> m_enums{};
+	std::map<uint64_t, ModuleType const*> m_modules{};
+	std::map<uint64_t, ModifierType const*> m_modifiers{};
+	std::map<std::tuple<uint64_t, FunctionType::Kind>, FunctionType const*> m_functionsOfDefinitions{};
+	std::map<uint64_t, FunctionType const*> m_functionsOfDeclarations{};
+	std::map<uint64_t, FunctionType const*> m_functionsOfTypeNames{};
+	std::map<
+		std::tuple<strings, strings, FunctionType::Kind, bool, StateMutability>,
+		FunctionType const*
+	> m_functionsOfTypeStrings{};
+	std::map<
+		std::tuple<
+			TypePointers, TypePointers, strings, strings, FunctionType::Kind, bool,
+			StateMutability, std::optional<uint64_t>, bool, bool, bool, bool
+		>,
+		FunctionType const*
+	> m_functions{};
 };
 
 }
@@ -261,15 +261,19 @@ string Type::escapeIdentifier(string const& _identifier)
 	return ret;
 }
 
-string Type::identifier() const
+string const& Type::identifier() const
 {
-	string ret = escapeIdentifier(richIdentifier());
-	solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	solAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	if (!m_identifier)
+	{
+		string ret = escapeIdentifier(richIdentifier());
+		solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		solAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
+			"Identifier contains invalid characters."
+		);
+		m_identifier = move(ret);
+	}
+	return *m_identifier;
 }
 
 Type const* Type::commonType(Type const* _a, Type const* _b)
@@ -389,7 +393,7 @@ AddressType::AddressType(StateMutability _stateMutability):
 	solAssert(m_stateMutability == StateMutability::Payable || m_stateMutability == StateMutability::NonPayable, "");
 }
 
-string AddressType::richIdentifier() const
+string AddressType::makeRichIdentifier() const
 {
 	if (m_stateMutability == StateMutability::Payable)
 		return "t_address_payable";
@@ -511,7 +515,7 @@ IntegerType::IntegerType(unsigned _bits, IntegerType::Modifier _modifier):
 	);
 }
 
-string IntegerType::richIdentifier() const
+string IntegerType::makeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "int" + to_string(numBits());
 }
@@ -678,7 +682,7 @@ FixedPointType::FixedPointType(unsigned _totalBits, unsigned _fractionalDigits,
 	);
 }
 
-string FixedPointType::richIdentifier() const
+string FixedPointType::makeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "fixed" + to_string(m_totalBits) + "x" + to_string(m_fractionalDigits);
 }
@@ -1046,7 +1050,7 @@ TypeResult RationalNumberType::binaryOperatorResult(Token _operator, Type const*
 		return nullptr;
 }
 
-string RationalNumberType::richIdentifier() const
+string RationalNumberType::makeRichIdentifier() const
 {
 	// rational seemingly will put the sign always on the numerator,
 	// but let just make it deterministic here.
@@ -1214,7 +1218,7 @@ BoolResult StringLiteralType::isImplicitlyConvertibleTo(Type const& _convertTo)
 		return false;
 }
 
-string StringLiteralType::richIdentifier() const
+string StringLiteralType::makeRichIdentifier() const
 {
 	// Since we have to return a valid identifier and the string itself may contain
 	// anything, we hash it.
@@ -1319,7 +1323,7 @@ MemberList::MemberMap FixedBytesType::nativeMembers(ASTNode const*) const
 	return MemberList::MemberMap{MemberList::Member{"length", TypeProvider::uint(8)}};
 }
 
-string FixedBytesType::richIdentifier() const
+string FixedBytesType::makeRichIdentifier() const
 {
 	return "t_bytes" + to_string(m_bytes);
 }
@@ -1581,7 +1585,7 @@ BoolResult ArrayType::isExplicitlyConvertibleTo(Type const& _convertTo) const
 	return true;
 }
 
-string ArrayType::richIdentifier() const
+string ArrayType::makeRichIdentifier() const
 {
 	string id;
 	if (isString())
@@ -1936,7 +1940,7 @@ BoolResult ArraySliceType::isExplicitlyConvertibleTo(Type const& _convertTo) con
 		m_arrayType.isExplicitlyConvertibleTo(_convertTo);
 }
 
-string ArraySliceType::richIdentifier() const
+string ArraySliceType::makeRichIdentifier() const
 {
 	return m_arrayType.richIdentifier() + "_slice";
 }
@@ -1971,7 +1975,7 @@ std::vector<std::tuple<std::string, Type const*>> ArraySliceType::makeStackItems
 	return {{"offset", TypeProvider::uint256()}, {"length", TypeProvider::uint256()}};
 }
 
-string ContractType::richIdentifier() const
+string ContractType::makeRichIdentifier() const
 {
 	return (m_super ? "t_super" : "t_contract") + parenthesizeUserIdentifier(m_contract.name()) + to_string(m_contract.id());
 }
@@ -2085,7 +2089,7 @@ BoolResult StructType::isImplicitlyConvertibleTo(Type const& _convertTo) const
 	return this->m_struct == convertTo.m_struct;
 }
 
-string StructType::richIdentifier() const
+string StructType::makeRichIdentifier() const
 {
 	return "t_struct" + parenthesizeUserIdentifier(m_struct.name()) + to_string(m_struct.id()) + identifierLocationSuffix();
 }
@@ -2478,7 +2482,7 @@ TypeResult EnumType::unaryOperatorResult(Token _operator) const
 	return _operator == Token::Delete ? TypeProvider::emptyTuple() : nullptr;
 }
 
-string EnumType::richIdentifier() const
+string EnumType::makeRichIdentifier() const
 {
 	return "t_enum" + parenthesizeUserIdentifier(m_enum.name()) + to_string(m_enum.id());
 }
@@ -2553,7 +2557,7 @@ BoolResult TupleType::isImplicitlyConvertibleTo(Type const& _other) const
 		return false;
 }
 
-string TupleType::richIdentifier() const
+string TupleType::makeRichIdentifier() const
 {
 	return "t_tuple" + identifierList(components());
 }
@@ -2859,7 +2863,7 @@ TypePointers const& FunctionType::parameterTypesIncludingSelf() const
 	return m_parameterTypes;
 }
 
-string FunctionType::richIdentifier() const
+string FunctionType::makeRichIdentifier() const
 {
 	string id = "t_function_";
 	switch (m_kind)
@@ -3605,7 +3609,7 @@ Type const* MappingType::encodingType() const
 	return TypeProvider::integer(256, IntegerType::Modifier::Unsigned);
 }
 
-string MappingType::richIdentifier() const
+string MappingType::makeRichIdentifier() const
 {
 	return "t_mapping" + identifierList(m_keyType, m_valueType);
 }
@@ -3651,7 +3655,7 @@ TypeResult MappingType::interfaceType(bool _inLibrary) const
 	return this;
 }
 
-string TypeType::richIdentifier() const
+string TypeType::makeRichIdentifier() const
 {
 	return "t_type" + identifierList(actualType());
 }
@@ -3794,7 +3798,7 @@ u256 ModifierType::storageSize() const
 	solAssert(false, "Storage size of non-storable type type requested.");
 }
 
-string ModifierType::richIdentifier() const
+string ModifierType::makeRichIdentifier() const
 {
 	return "t_modifier" + identifierList(m_parameterTypes);
 }
@@ -3827,7 +3831,7 @@ string ModifierType::toString(bool _short) const
 	return name + ")";
 }
 
-string ModuleType::richIdentifier() const
+string ModuleType::makeRichIdentifier() const
 {
 	return "t_module_" + to_string(m_sourceUnit.id());
 }
@@ -3853,7 +3857,7 @@ string ModuleType::toString(bool) const
 	return string("module \"") + *m_sourceUnit.annotation().path + string("\"");
 }
 
-string MagicType::richIdentifier() const
+string MagicType::makeRichIdentifier() const
 {
 	switch (m_kind)
 	{
@@ -187,12 +187,19 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Can contain characters which are invalid in identifiers.
-	virtual std::string richIdentifier() const = 0;
+	/// The identifier is computed only once per type object.
+	std::string const& richIdentifier() const
+	{
+		if (!m_richIdentifier)
+			m_richIdentifier = makeRichIdentifier();
+		return *m_richIdentifier;
+	}
 	/// @returns a valid solidity identifier such that two types should compare equal if and
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// The identifier is computed only once per type object.
+	std::string const& identifier() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -376,6 +383,8 @@ private:
 	static MemberList::MemberMap boundFunctions(Type const& _type, ASTNode const& _scope);
 
 protected:
+	/// Generates the identifier to be returned by ``richIdentifier()``.
+	virtual std::string makeRichIdentifier() const = 0;
 	/// @returns the members native to this type depending on the given context. This function
 	/// is used (in conjunction with boundFunctions to fill m_members below.
 	virtual MemberList::MemberMap nativeMembers(ASTNode const* /*_currentScope*/) const
@@ -394,6 +403,10 @@ protected:
 	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
+	/// Identifiers, lazy-initialized. They do not depend on the analysis state and are therefore
+	/// not reset by ``clearCache()``.
+	mutable std::optional<std::string> m_richIdentifier;
+	mutable std::optional<std::string> m_identifier;
 };
 
 /**
@@ -406,7 +419,6 @@ public:
 
 	Category category() const override { return Category::Address; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -432,6 +444,8 @@ public:
 
 	StateMutability stateMutability(void) const { return m_stateMutability; }
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	StateMutability m_stateMutability;
 };
@@ -451,7 +465,6 @@ public:
 
 	Category category() const override { return Category::Integer; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -479,6 +492,8 @@ public:
 	bigint minValue() const;
 	bigint maxValue() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	unsigned const m_bits;
 	Modifier const m_modifier;
@@ -498,7 +513,6 @@ public:
 	explicit FixedPointType(unsigned _totalBits, unsigned _fractionalDigits, Modifier _modifier = Modifier::Unsigned);
 	Category category() const override { return Category::FixedPoint; }
 
-	std::string richIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -532,6 +546,8 @@ public:
 	/// @returns the smallest integer type that can hold this type with fractional parts shifted to integers.
 	IntegerType const* asIntegerType() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	unsigned m_totalBits;
 	unsigned m_fractionalDigits;
@@ -557,7 +573,6 @@ public:
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
@@ -590,6 +605,8 @@ public:
 	/// @returns true if the literal is a valid integer.
 	static std::tuple<bool, rational> isValidLiteral(Literal const& _literal);
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	rational m_value;
 
@@ -622,7 +639,6 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
@@ -633,6 +649,7 @@ public:
 	std::string const& value() const { return m_value; }
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override { return {}; }
 private:
 	std::string m_value;
@@ -650,7 +667,6 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
@@ -668,6 +684,8 @@ public:
 
 	unsigned numBytes() const { return m_bytes; }
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	unsigned m_bytes;
 };
@@ -679,7 +697,6 @@ class BoolType: public Type
 {
 public:
 	Category category() const override { return Category::Bool; }
-	std::string richIdentifier() const override { return "t_bool"; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
@@ -693,6 +710,9 @@ public:
 	u256 literalValue(Literal const* _literal) const override;
 	Type const* encodingType() const override { return this; }
 	TypeResult interfaceType(bool) const override { return this; }
+
+protected:
+	std::string makeRichIdentifier() const override { return "t_bool"; }
 };
 
 /**
@@ -815,7 +835,6 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override;
 	unsigned calldataEncodedTailSize() const override;
@@ -857,6 +876,7 @@ public:
 	void clearCache() const override;
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override { return {m_baseType}; }
 
@@ -883,7 +903,6 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override { solAssert(false, ""); }
 	unsigned calldataEncodedTailSize() const override { return 32; }
@@ -900,6 +919,7 @@ public:
 	std::unique_ptr<ReferenceType> copyForLocation(DataLocation, bool) const override { solAssert(false, ""); }
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override { return {m_arrayType.baseType()}; }
 
@@ -922,7 +942,6 @@ public:
 	/// Contracts can only be explicitly converted to address types and base contracts.
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded ) const override
 	{
@@ -965,6 +984,7 @@ public:
 	/// @returns a list of all immutable variables (including inherited) of the contract.
 	std::vector<VariableDeclaration const*> immutableVariables() const;
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 private:
 	ContractDefinition const& m_contract;
@@ -985,7 +1005,6 @@ public:
 
 	Category category() const override { return Category::Struct; }
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool) const override;
 	unsigned calldataEncodedTailSize() const override;
@@ -1027,6 +1046,7 @@ public:
 	void clearCache() const override;
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override;
 
@@ -1047,7 +1067,6 @@ public:
 
 	Category category() const override { return Category::Enum; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded) const override
 	{
@@ -1072,6 +1091,8 @@ public:
 	unsigned int memberValue(ASTString const& _member) const;
 	size_t numberOfMembers() const;
 
+protected:
+	std::string makeRichIdentifier() const override;
 private:
 	EnumDefinition const& m_enum;
 };
@@ -1088,7 +1109,6 @@ public:
 	Category category() const override { return Category::Tuple; }
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
 	std::string toString(bool) const override;
@@ -1100,6 +1120,7 @@ public:
 	std::vector<Type const*> const& components() const { return m_components; }
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 	std::vector<Type const*> decomposition() const override
 	{
@@ -1255,7 +1276,6 @@ public:
 	/// @returns the "self" parameter type for a bound function
 	Type const* selfType() const;
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
@@ -1368,6 +1388,7 @@ public:
 	FunctionTypePointer asExternallyCallableFunction(bool _inLibrary) const;
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 private:
 	static TypePointers parseElementaryTypeVector(strings const& _types);
@@ -1401,7 +1422,6 @@ public:
 
 	Category category() const override { return Category::Mapping; }
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	std::string toString(bool _short) const override;
 	std::string canonicalName() const override;
@@ -1418,6 +1438,7 @@ public:
 	Type const* valueType() const { return m_valueType; }
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<Type const*> decomposition() const override { return {m_valueType}; }
 
 private:
@@ -1439,7 +1460,6 @@ public:
 	Type const* actualType() const { return m_actualType; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
@@ -1449,6 +1469,7 @@ public:
 
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 private:
 	Type const* m_actualType;
@@ -1469,10 +1490,10 @@ public:
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	std::string toString(bool _short) const override;
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override { return {}; }
 private:
 	TypePointers m_parameterTypes;
@@ -1491,7 +1512,6 @@ public:
 	Category category() const override { return Category::Module; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
@@ -1500,6 +1520,7 @@ public:
 	std::string toString(bool _short) const override;
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override { return {}; }
 private:
 	SourceUnit const& m_sourceUnit;
@@ -1530,7 +1551,6 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
@@ -1543,6 +1563,7 @@ public:
 	Type const* typeArgument() const;
 
 protected:
+	std::string makeRichIdentifier() const override;
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override { return {}; }
 private:
 	Kind m_kind;
@@ -1559,7 +1580,6 @@ class InaccessibleDynamicType: public Type
 public:
 	Category category() const override { return Category::InaccessibleDynamic; }
 
-	std::string richIdentifier() const override { return "t_inaccessible"; }
 	BoolResult isImplicitlyConvertibleTo(Type const&) const override { return false; }
 	BoolResult isExplicitlyConvertibleTo(Type const&) const override { return false; }
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
@@ -1569,6 +1589,9 @@ public:
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	std::string toString(bool) const override { return "inaccessible dynamic type"; }
 	Type const* decodingType() const override;
+
+protected:
+	std::string makeRichIdentifier() const override { return "t_inaccessible"; }
 };
 
 }
@@ -33,7 +33,8 @@ using namespace solidity::frontend;
 void Compiler::compileContract(
 	ContractDefinition const& _contract,
 	std::map<ContractDefinition const*, shared_ptr<Compiler const>> const& _otherCompilers,
-	bytes const& _metadata
+	bytes const& _metadata,
+	util::ThreadPool* _threadPool
 )
 {
 	ContractCompiler runtimeCompiler(nullptr, m_runtimeContext, m_optimiserSettings);
@@ -49,7 +50,7 @@ void Compiler::compileContract(
 	ContractCompiler creationCompiler(&runtimeCompiler, m_context, creationSettings);
 	m_runtimeSub = creationCompiler.compileConstructor(_contract, _otherCompilers);
 
-	m_context.optimise(m_optimiserSettings);
+	m_context.optimise(m_optimiserSettings, _threadPool);
 
 	solAssert(m_context.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
 	solAssert(m_runtimeContext.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
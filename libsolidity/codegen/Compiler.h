@@ -45,10 +45,12 @@ public:
 
 	/// Compiles a contract.
 	/// @arg _metadata contains the to be injected metadata CBOR
+	/// @arg _threadPool if given, sub-assemblies are optimised concurrently on it
 	void compileContract(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
-		bytes const& _metadata
+		bytes const& _metadata,
+		util::ThreadPool* _threadPool = nullptr
 	);
 	/// @returns Entire assembly.
 	evmasm::Assembly const& assembly() const { return m_context.assembly(); }
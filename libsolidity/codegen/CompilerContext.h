@@ -281,8 +281,11 @@ public:
 	/// Appends arbitrary data to the end of the bytecode.
 	void appendToAuxiliaryData(bytes const& _data) { m_asm->appendToAuxiliaryData(_data); }
 
-	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	/// Run optimisation step, optimising sub-assemblies on @a _threadPool if given.
+	void optimise(OptimiserSettings const& _settings, util::ThreadPool* _threadPool = nullptr)
+	{
+		m_asm->optimise(translateOptimiserSettings(_settings), _threadPool);
+	}
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
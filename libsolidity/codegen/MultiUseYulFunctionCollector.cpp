@@ -26,6 +26,8 @@
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
@@ -33,12 +35,18 @@ using namespace solidity::util;
 
 string MultiUseYulFunctionCollector::requestedFunctions()
 {
+	vector<pair<string const, string> const*> functions;
+	functions.reserve(m_requestedFunctions.size());
+	for (auto const& function: m_requestedFunctions)
+		functions.emplace_back(&function);
+	// Output the functions in ascending order of their names.
+	sort(functions.begin(), functions.end(), [](auto const* _a, auto const* _b) { return _a->first < _b->first; });
+
 	string result;
-	for (auto const& [name, code]: m_requestedFunctions)
+	for (auto const* function: functions)
 	{
-		solAssert(code != "<<STUB<<", "");
-		// std::map guarantees ascending order when iterating through its keys.
-		result += code;
+		solAssert(function->second != "<<STUB<<", "");
+		result += function->second;
 	}
 	m_requestedFunctions.clear();
 	return result;
@@ -46,13 +54,15 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
+	auto [it, inserted] = m_requestedFunctions.try_emplace(_name, "<<STUB<<");
+	if (inserted)
 	{
-		m_requestedFunctions[_name] = "<<STUB<<";
+		// References into the map stay valid while the creator requests further functions.
+		string& code = it->second;
 		string fun = _creator();
 		solAssert(!fun.empty(), "");
 		solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
+		code = std::move(fun);
 	}
 	return _name;
 }
@@ -63,15 +73,16 @@ string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	auto [it, inserted] = m_requestedFunctions.try_emplace(_name, "<<STUB<<");
+	if (inserted)
 	{
-		m_requestedFunctions[_name] = "<<STUB<<";
+		string& code = it->second;
 		vector<string> arguments;
 		vector<string> returnParameters;
 		string body = _creator(arguments, returnParameters);
 		solAssert(!body.empty(), "");
 
-		m_requestedFunctions[_name] = Whiskers(R"(
+		code = Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
@@ -23,8 +23,9 @@
 #pragma once
 
 #include <functional>
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -57,8 +58,9 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
-	/// Map from function name to code for a multi-use function.
-	std::map<std::string, std::string> m_requestedFunctions;
+	/// Map from function name to code for a multi-use function. Hashed, since the names are
+	/// long and often share prefixes; the functions are sorted only when they are retrieved.
+	std::unordered_map<std::string, std::string> m_requestedFunctions;
 };
 
 }
@@ -30,14 +30,19 @@
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
 
+#include <libyul/AsmParser.h>
 #include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
 #include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
 
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/Algorithms.h>
 
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Scanner.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
 #include <range/v3/view/map.hpp>
@@ -88,22 +93,66 @@ set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCallables(
 
 }
 
-pair<string, string> IRGenerator::run(
+tuple<string, string, shared_ptr<yul::Object const>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	map<ContractDefinition const*, string_view const> const& _otherYulSources,
+	map<ContractDefinition const*, shared_ptr<yul::Object const>> const& _otherYulObjects
 )
 {
-	string const ir = yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+	GeneratedIR generated = generate(_contract, _cborMetadata, _otherYulSources);
+	string const ir = yul::reindent(generated.source);
 
-	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	if (!asmStack.parseAndAnalyze("", ir))
-	{
+	auto invalidIR = [&](langutil::ErrorList const& _errors) {
 		string errorMessage;
-		for (auto const& error: asmStack.errors())
+		for (auto const& error: _errors)
 			errorMessage += langutil::SourceReferenceFormatter::formatErrorInformation(*error);
 		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
-	}
+	};
+	auto parseCode = [&](string const& _code) -> shared_ptr<yul::Block> {
+		langutil::ErrorList errors;
+		langutil::ErrorReporter errorReporter(errors);
+		auto scanner = make_shared<langutil::Scanner>(langutil::CharStream("{\n" + _code + "\n}", ""));
+		shared_ptr<yul::Block> code = yul::Parser(
+			errorReporter,
+			yul::EVMDialect::strictAssemblyForEVMObjects(m_evmVersion)
+		).parse(scanner, false);
+		if (!errors.empty())
+			invalidIR(errors);
+		solAssert(code, "");
+		return code;
+	};
+	// The contracts created by this one are added as copies of their unoptimized objects,
+	// so that their code does not have to be parsed again for every contract that creates them.
+	auto addSubObject = [](yul::Object& _container, shared_ptr<yul::ObjectNode> _subObject) {
+		solAssert(
+			!_container.subIndexByName.count(_subObject->name),
+			"Duplicate sub-object name " + _subObject->name.str() + " in " + _container.name.str() + "."
+		);
+		_container.subIndexByName[_subObject->name] = _container.subObjects.size();
+		_container.subObjects.emplace_back(move(_subObject));
+	};
+
+	auto deployedObject = make_shared<yul::Object>();
+	deployedObject->name = yul::YulString{IRNames::deployedObject(_contract)};
+	deployedObject->code = parseCode(generated.deployedCode);
+	for (ContractDefinition const* subObject: generated.deployedSubObjects)
+		addSubObject(*deployedObject, _otherYulObjects.at(subObject)->clone());
+	addSubObject(
+		*deployedObject,
+		make_shared<yul::Data>(yul::YulString{yul::Object::metadataName()}, _cborMetadata)
+	);
+
+	auto object = make_shared<yul::Object>();
+	object->name = yul::YulString{IRNames::creationObject(_contract)};
+	object->code = parseCode(generated.creationCode);
+	addSubObject(*object, move(deployedObject));
+	for (ContractDefinition const* subObject: generated.subObjects)
+		addSubObject(*object, _otherYulObjects.at(subObject)->clone());
+
+	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+	if (!asmStack.analyze(object->clone()))
+		invalidIR(asmStack.errors());
 	asmStack.optimize();
 
 	string warning =
@@ -114,10 +163,10 @@ pair<string, string> IRGenerator::run(
 		" *                !USE AT YOUR OWN RISK!               *\n"
 		" *=====================================================*/\n\n";
 
-	return {warning + ir, warning + asmStack.print()};
+	return {warning + ir, warning + asmStack.print(), move(object)};
 }
 
-string IRGenerator::generate(
+IRGenerator::GeneratedIR IRGenerator::generate(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
 	map<ContractDefinition const*, string_view const> const& _otherYulSources
@@ -134,7 +183,20 @@ string IRGenerator::generate(
 	Whiskers t(R"(
 		object "<CreationObject>" {
 			code {
-				<sourceLocationComment>
+				<creationCode>
+			}
+			object "<DeployedObject>" {
+				code {
+					<deployedCode>
+				}
+				<deployedSubObjects>
+				data "<metadataName>" hex"<cborMetadata>"
+			}
+			<subObjects>
+		}
+	)");
+	// The code blocks are rendered separately, so that they can be parsed without the sub-objects.
+	Whiskers creation(R"(<sourceLocationComment>
 				<memoryInitCreation>
 				<callValueCheck>
 				<?library>
@@ -143,61 +205,58 @@ string IRGenerator::generate(
 				<constructor>(<constructorParams>)
 				</library>
 				<deploy>
-				<functions>
-			}
-			object "<DeployedObject>" {
-				code {
-					<sourceLocationComment>
+				<functions>)");
+	Whiskers deployed(R"(<sourceLocationComment>
 					<memoryInitDeployed>
 					<?library>
 					let called_via_delegatecall := iszero(eq(loadimmutable("<library_address>"), address()))
 					</library>
 					<dispatch>
-					<deployedFunctions>
-				}
-				<deployedSubObjects>
-				data "<metadataName>" hex"<cborMetadata>"
-			}
-			<subObjects>
-		}
-	)");
+					<deployedFunctions>)");
+	GeneratedIR generated;
 
 	resetContext(_contract);
 	for (VariableDeclaration const* var: ContractType(_contract).immutableVariables())
 		m_context.registerImmutableVariable(*var);
 
-	t("sourceLocationComment", sourceLocationComment(_contract, m_context));
+	string const locationComment = sourceLocationComment(_contract, m_context);
+	creation("sourceLocationComment", locationComment);
+	deployed("sourceLocationComment", locationComment);
 
 	t("CreationObject", IRNames::creationObject(_contract));
-	t("library", _contract.isLibrary());
+	creation("library", _contract.isLibrary());
+	deployed("library", _contract.isLibrary());
 
 	FunctionDefinition const* constructor = _contract.constructor();
-	t("callValueCheck", !constructor || !constructor->isPayable() ? callValueCheck() : "");
+	creation("callValueCheck", !constructor || !constructor->isPayable() ? callValueCheck() : "");
 	vector<string> constructorParams;
 	if (constructor && !constructor->parameters().empty())
 	{
 		for (size_t i = 0; i < CompilerUtils::sizeOnStack(constructor->parameters()); ++i)
 			constructorParams.emplace_back(m_context.newYulVariable());
-		t(
+		creation(
 			"copyConstructorArguments",
 			m_utils.copyConstructorArgumentsToMemoryFunction(_contract, IRNames::creationObject(_contract))
 		);
 	}
-	t("constructorParams", joinHumanReadable(constructorParams));
-	t("constructorHasParams", !constructorParams.empty());
-	t("constructor", IRNames::constructor(_contract));
+	creation("constructorParams", joinHumanReadable(constructorParams));
+	creation("constructorHasParams", !constructorParams.empty());
+	creation("constructor", IRNames::constructor(_contract));
 
-	t("deploy", deployCode(_contract));
+	creation("deploy", deployCode(_contract));
 	generateConstructors(_contract);
 	set<FunctionDefinition const*> creationFunctionList = generateQueuedFunctions();
 	InternalDispatchMap internalDispatchMap = generateInternalDispatchFunctions(_contract);
 
-	t("functions", m_context.functionCollector().requestedFunctions());
-	t("subObjects", subObjectSources(m_context.subObjectsCreated()));
+	creation("functions", m_context.functionCollector().requestedFunctions());
+	generated.subObjects = m_context.subObjectsCreated();
+	t("subObjects", subObjectSources(generated.subObjects));
 
 	// This has to be called only after all other code generation for the creation object is complete.
 	bool creationInvolvesAssembly = m_context.inlineAssemblySeen();
-	t("memoryInitCreation", memoryInit(!creationInvolvesAssembly));
+	creation("memoryInitCreation", memoryInit(!creationInvolvesAssembly));
+	generated.creationCode = creation.render();
+	t("creationCode", generated.creationCode);
 
 	resetContext(_contract);
 
@@ -208,26 +267,30 @@ string IRGenerator::generate(
 
 	// Do not register immutables to avoid assignment.
 	t("DeployedObject", IRNames::deployedObject(_contract));
-	t("library_address", IRNames::libraryAddressImmutable());
-	t("dispatch", dispatchRoutine(_contract));
+	deployed("library_address", IRNames::libraryAddressImmutable());
+	deployed("dispatch", dispatchRoutine(_contract));
 	set<FunctionDefinition const*> deployedFunctionList = generateQueuedFunctions();
 	generateInternalDispatchFunctions(_contract);
-	t("deployedFunctions", m_context.functionCollector().requestedFunctions());
-	t("deployedSubObjects", subObjectSources(m_context.subObjectsCreated()));
+	deployed("deployedFunctions", m_context.functionCollector().requestedFunctions());
+	generated.deployedSubObjects = m_context.subObjectsCreated();
+	t("deployedSubObjects", subObjectSources(generated.deployedSubObjects));
 	t("metadataName", yul::Object::metadataName());
 	t("cborMetadata", toHex(_cborMetadata));
 
 
 	// This has to be called only after all other code generation for the deployed object is complete.
 	bool deployedInvolvesAssembly = m_context.inlineAssemblySeen();
-	t("memoryInitDeployed", memoryInit(!deployedInvolvesAssembly));
+	deployed("memoryInitDeployed", memoryInit(!deployedInvolvesAssembly));
+	generated.deployedCode = deployed.render();
+	t("deployedCode", generated.deployedCode);
 
 	solAssert(_contract.annotation().creationCallGraph->get() != nullptr, "");
 	solAssert(_contract.annotation().deployedCallGraph->get() != nullptr, "");
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().creationCallGraph), move(creationFunctionList));
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().deployedCallGraph), move(deployedFunctionList));
 
-	return t.render();
+	generated.source = t.render();
+	return generated;
 }
 
 string IRGenerator::generate(Block const& _block)
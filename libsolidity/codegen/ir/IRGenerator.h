@@ -29,7 +29,14 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+#include <memory>
 #include <string>
+#include <tuple>
+
+namespace solidity::yul
+{
+struct Object;
+}
 
 namespace solidity::frontend
 {
@@ -52,15 +59,31 @@ public:
 	{}
 
 	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// (or just pretty-printed, depending on the optimizer settings), together with
+	/// the unoptimized Yul object.
+	/// The Yul object is built from the code of the contract itself and the unoptimized objects
+	/// of the contracts it creates, which are taken from @a _otherYulObjects instead of parsing
+	/// their source code again.
+	std::tuple<std::string, std::string, std::shared_ptr<yul::Object const>> run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 	);
 
 private:
-	std::string generate(
+	/// The IR of a contract, both as the source of the complete object and as the code
+	/// of its creation and deployed object together with the contracts they create.
+	struct GeneratedIR
+	{
+		std::string source;
+		std::string creationCode;
+		std::string deployedCode;
+		std::set<ContractDefinition const*, ASTNode::CompareByID> subObjects;
+		std::set<ContractDefinition const*, ASTNode::CompareByID> deployedSubObjects;
+	};
+
+	GeneratedIR generate(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
 		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
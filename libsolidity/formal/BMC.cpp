@@ -22,6 +22,8 @@
 
 #include <libsmtutil/SMTPortfolio.h>
 
+#include <libsolutil/Parallel.h>
+
 #ifdef HAVE_Z3_DLOPEN
 #include <z3_version.h>
 #endif
@@ -41,7 +43,13 @@ BMC::BMC(
 	ModelCheckerSettings const& _settings
 ):
 	SMTEncoder(_context, _settings),
-	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers, _settings.timeout)),
+	m_interface(make_unique<smtutil::SMTPortfolio>(
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		_settings.timeout,
+		_settings.raceSolvers
+	)),
 	m_outerErrorReporter(_errorReporter)
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
@@ -660,8 +668,34 @@ pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
 
 void BMC::checkVerificationTargets()
 {
+	if (checkInParallel())
+	{
+		m_deferredQueries.emplace();
+		// Without parallelism, constant conditions are checked as soon as they are encountered,
+		// i.e. before all other targets of the function. They are reported in the same order here.
+		stable_partition(m_verificationTargets.begin(), m_verificationTargets.end(), [](auto const& _target) {
+			return _target.type == VerificationTargetType::ConstantCondition;
+		});
+	}
 	for (auto& target: m_verificationTargets)
 		checkVerificationTarget(target);
+	if (m_deferredQueries)
+	{
+		checkDeferredQueries();
+		m_deferredQueries.reset();
+	}
+}
+
+bool BMC::checkInParallel() const
+{
+	// SMT-LIB2 responses and the callback are only used by the main solver, so
+	// queries are only checked concurrently if Z3 or CVC4 has to answer them anyway.
+	auto const* portfolio = dynamic_cast<smtutil::SMTPortfolio const*>(m_interface.get());
+	return
+		m_settings.jobs > 1 &&
+		portfolio &&
+		m_interface->solvers() > 1 &&
+		!portfolio->answersSMTLib2Queries();
 }
 
 void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
@@ -849,7 +883,7 @@ void BMC::addVerificationTarget(
 		m_callStack,
 		modelExpressions()
 	};
-	if (_type == VerificationTargetType::ConstantCondition)
+	if (_type == VerificationTargetType::ConstantCondition && !checkInParallel())
 		checkVerificationTarget(target);
 	else
 		m_verificationTargets.emplace_back(move(target));
@@ -869,78 +903,35 @@ void BMC::checkCondition(
 	smtutil::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
-	vector<smtutil::Expression> expressionsToEvaluate;
-	vector<string> expressionNames;
-	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
+	ConditionQuery query{
+		move(_condition),
+		_modelExpressions.first,
+		_modelExpressions.second,
+		_callStack,
+		_location,
+		_errorHappens,
+		_errorMightHappen,
+		_description
+	};
 	if (_callStack.size())
 		if (_additionalValue)
 		{
-			expressionsToEvaluate.emplace_back(*_additionalValue);
-			expressionNames.push_back(_additionalValueName);
+			query.expressionsToEvaluate.emplace_back(*_additionalValue);
+			query.expressionNames.push_back(_additionalValueName);
 		}
-	smtutil::CheckResult result;
-	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
 
-	string extraComment = SMTEncoder::extraComment();
-	if (m_loopExecutionHappened)
-		extraComment +=
-			"\nNote that some information is erased after the execution of loops.\n"
-			"You can re-introduce information using require().";
-	if (m_externalFunctionCallHappened)
-		extraComment +=
-			"\nNote that external function calls are not inlined,"
-			" even if the source code of the function is available."
-			" This is due to the possibility that the actual called contract"
-			" has the same ABI but implements the function differently.";
-
-	SecondarySourceLocation secondaryLocation{};
-	secondaryLocation.append(extraComment, SourceLocation{});
-
-	switch (result)
-	{
-	case smtutil::CheckResult::SATISFIABLE:
+	if (m_deferredQueries)
 	{
-		solAssert(!_callStack.empty(), "");
-		std::ostringstream message;
-		message << "BMC: " << _description << " happens here.";
-		std::ostringstream modelMessage;
-		modelMessage << "Counterexample:\n";
-		solAssert(values.size() == expressionNames.size(), "");
-		map<string, string> sortedModel;
-		for (size_t i = 0; i < values.size(); ++i)
-			if (expressionsToEvaluate.at(i).name != values.at(i))
-				sortedModel[expressionNames.at(i)] = values.at(i);
-
-		for (auto const& eval: sortedModel)
-			modelMessage << "  " << eval.first << " = " << eval.second << "\n";
-
-		m_errorReporter.warning(
-			_errorHappens,
-			_location,
-			message.str(),
-			SecondarySourceLocation().append(modelMessage.str(), SourceLocation{})
-			.append(SMTEncoder::callStackMessage(_callStack))
-			.append(move(secondaryLocation))
-		);
-		break;
-	}
-	case smtutil::CheckResult::UNSATISFIABLE:
-		break;
-	case smtutil::CheckResult::UNKNOWN:
-		m_errorReporter.warning(_errorMightHappen, _location, "BMC: " + _description + " might happen here.", secondaryLocation);
-		break;
-	case smtutil::CheckResult::CONFLICTING:
-		m_errorReporter.warning(1584_error, _location, "BMC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
-	case smtutil::CheckResult::ERROR:
-		m_errorReporter.warning(1823_error, _location, "BMC: Error trying to invoke SMT solver.");
-		break;
+		m_deferredQueries->emplace_back(move(query));
+		return;
 	}
 
+	m_interface->push();
+	m_interface->addAssertion(query.condition);
+	smtutil::CheckResult result;
+	vector<string> values;
+	tie(result, values) = checkSatisfiableAndGenerateModel(query.expressionsToEvaluate);
+	reportCondition(query, result, values);
 	m_interface->pop();
 }
 
@@ -955,68 +946,98 @@ void BMC::checkBooleanNotConstant(
 	if (dynamic_cast<Literal const*>(&_condition))
 		return;
 
+	ConstantConditionQuery query{&_condition, _constraints, _value, _callStack};
+	if (m_deferredQueries)
+	{
+		m_deferredQueries->emplace_back(move(query));
+		return;
+	}
+
 	m_interface->push();
-	m_interface->addAssertion(_constraints && _value);
+	m_interface->addAssertion(query.constraints && query.value);
 	auto positiveResult = checkSatisfiable();
 	m_interface->pop();
 
 	m_interface->push();
-	m_interface->addAssertion(_constraints && !_value);
+	m_interface->addAssertion(query.constraints && !query.value);
 	auto negatedResult = checkSatisfiable();
 	m_interface->pop();
 
-	if (positiveResult == smtutil::CheckResult::ERROR || negatedResult == smtutil::CheckResult::ERROR)
-		m_errorReporter.warning(8592_error, _condition.location(), "BMC: Error trying to invoke SMT solver.");
-	else if (positiveResult == smtutil::CheckResult::CONFLICTING || negatedResult == smtutil::CheckResult::CONFLICTING)
-		m_errorReporter.warning(3356_error, _condition.location(), "BMC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-	else if (positiveResult == smtutil::CheckResult::SATISFIABLE && negatedResult == smtutil::CheckResult::SATISFIABLE)
+	reportConstantCondition(query, positiveResult, negatedResult);
+}
+
+void BMC::reportConstantCondition(
+	ConstantConditionQuery const& _query,
+	smtutil::CheckResult _positiveResult,
+	smtutil::CheckResult _negatedResult
+)
+{
+	SourceLocation const& location = _query.condition->location();
+	if (_positiveResult == smtutil::CheckResult::ERROR || _negatedResult == smtutil::CheckResult::ERROR)
+		m_errorReporter.warning(8592_error, location, "BMC: Error trying to invoke SMT solver.");
+	else if (_positiveResult == smtutil::CheckResult::CONFLICTING || _negatedResult == smtutil::CheckResult::CONFLICTING)
+		m_errorReporter.warning(3356_error, location, "BMC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+	else if (_positiveResult == smtutil::CheckResult::SATISFIABLE && _negatedResult == smtutil::CheckResult::SATISFIABLE)
 	{
 		// everything fine.
 	}
-	else if (positiveResult == smtutil::CheckResult::UNKNOWN || negatedResult == smtutil::CheckResult::UNKNOWN)
+	else if (_positiveResult == smtutil::CheckResult::UNKNOWN || _negatedResult == smtutil::CheckResult::UNKNOWN)
 	{
 		// can't do anything.
 	}
-	else if (positiveResult == smtutil::CheckResult::UNSATISFIABLE && negatedResult == smtutil::CheckResult::UNSATISFIABLE)
-		m_errorReporter.warning(2512_error, _condition.location(), "BMC: Condition unreachable.", SMTEncoder::callStackMessage(_callStack));
+	else if (_positiveResult == smtutil::CheckResult::UNSATISFIABLE && _negatedResult == smtutil::CheckResult::UNSATISFIABLE)
+		m_errorReporter.warning(2512_error, location, "BMC: Condition unreachable.", SMTEncoder::callStackMessage(_query.callStack));
 	else
 	{
 		string description;
-		if (positiveResult == smtutil::CheckResult::SATISFIABLE)
+		if (_positiveResult == smtutil::CheckResult::SATISFIABLE)
 		{
-			solAssert(negatedResult == smtutil::CheckResult::UNSATISFIABLE, "");
+			solAssert(_negatedResult == smtutil::CheckResult::UNSATISFIABLE, "");
 			description = "BMC: Condition is always true.";
 		}
 		else
 		{
-			solAssert(positiveResult == smtutil::CheckResult::UNSATISFIABLE, "");
-			solAssert(negatedResult == smtutil::CheckResult::SATISFIABLE, "");
+			solAssert(_positiveResult == smtutil::CheckResult::UNSATISFIABLE, "");
+			solAssert(_negatedResult == smtutil::CheckResult::SATISFIABLE, "");
 			description = "BMC: Condition is always false.";
 		}
 		m_errorReporter.warning(
 			6838_error,
-			_condition.location(),
+			location,
 			description,
-			SMTEncoder::callStackMessage(_callStack)
+			SMTEncoder::callStackMessage(_query.callStack)
 		);
 	}
 }
 
 pair<smtutil::CheckResult, vector<string>>
 BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expressionsToEvaluate)
+{
+	optional<string> errorMessage;
+	auto result = solve(*m_interface, _expressionsToEvaluate, errorMessage);
+	if (errorMessage)
+		m_errorReporter.warning(8140_error, *errorMessage);
+	return result;
+}
+
+pair<smtutil::CheckResult, vector<string>> BMC::solve(
+	smtutil::SolverInterface& _solver,
+	vector<smtutil::Expression> const& _expressionsToEvaluate,
+	optional<string>& _errorMessage
+)
 {
 	smtutil::CheckResult result;
 	vector<string> values;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = _solver.check(_expressionsToEvaluate);
 	}
 	catch (smtutil::SolverError const& _e)
 	{
 		string description("BMC: Error querying SMT solver");
 		if (_e.comment())
 			description += ": " + *_e.comment();
-		m_errorReporter.warning(8140_error, description);
+		_errorMessage = move(description);
 		result = smtutil::CheckResult::ERROR;
 	}
 
@@ -1038,6 +1059,117 @@ smtutil::CheckResult BMC::checkSatisfiable()
 	return checkSatisfiableAndGenerateModel({}).first;
 }
 
+void BMC::reportCondition(ConditionQuery const& _query, smtutil::CheckResult _result, vector<string> const& _values)
+{
+	string extraComment = SMTEncoder::extraComment();
+	if (m_loopExecutionHappened)
+		extraComment +=
+			"\nNote that some information is erased after the execution of loops.\n"
+			"You can re-introduce information using require().";
+	if (m_externalFunctionCallHappened)
+		extraComment +=
+			"\nNote that external function calls are not inlined,"
+			" even if the source code of the function is available."
+			" This is due to the possibility that the actual called contract"
+			" has the same ABI but implements the function differently.";
+
+	SecondarySourceLocation secondaryLocation{};
+	secondaryLocation.append(extraComment, SourceLocation{});
+
+	switch (_result)
+	{
+	case smtutil::CheckResult::SATISFIABLE:
+	{
+		solAssert(!_query.callStack.empty(), "");
+		std::ostringstream message;
+		message << "BMC: " << _query.description << " happens here.";
+		std::ostringstream modelMessage;
+		modelMessage << "Counterexample:\n";
+		solAssert(_values.size() == _query.expressionNames.size(), "");
+		map<string, string> sortedModel;
+		for (size_t i = 0; i < _values.size(); ++i)
+			if (_query.expressionsToEvaluate.at(i).name != _values.at(i))
+				sortedModel[_query.expressionNames.at(i)] = _values.at(i);
+
+		for (auto const& eval: sortedModel)
+			modelMessage << "  " << eval.first << " = " << eval.second << "\n";
+
+		m_errorReporter.warning(
+			_query.errorHappens,
+			_query.location,
+			message.str(),
+			SecondarySourceLocation().append(modelMessage.str(), SourceLocation{})
+			.append(SMTEncoder::callStackMessage(_query.callStack))
+			.append(move(secondaryLocation))
+		);
+		break;
+	}
+	case smtutil::CheckResult::UNSATISFIABLE:
+		break;
+	case smtutil::CheckResult::UNKNOWN:
+		m_errorReporter.warning(_query.errorMightHappen, _query.location, "BMC: " + _query.description + " might happen here.", secondaryLocation);
+		break;
+	case smtutil::CheckResult::CONFLICTING:
+		m_errorReporter.warning(1584_error, _query.location, "BMC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+		break;
+	case smtutil::CheckResult::ERROR:
+		m_errorReporter.warning(1823_error, _query.location, "BMC: Error trying to invoke SMT solver.");
+		break;
+	}
+}
+
+void BMC::checkDeferredQueries()
+{
+	solAssert(m_deferredQueries, "");
+	auto const* portfolio = dynamic_cast<smtutil::SMTPortfolio const*>(m_interface.get());
+	solAssert(portfolio, "");
+
+	// Constant conditions need two checks, all other queries one.
+	vector<pair<smtutil::Expression, vector<smtutil::Expression>>> checks;
+	for (auto const& query: *m_deferredQueries)
+		if (auto const* conditionQuery = get_if<ConditionQuery>(&query))
+			checks.emplace_back(conditionQuery->condition, conditionQuery->expressionsToEvaluate);
+		else
+		{
+			auto const& constantConditionQuery = get<ConstantConditionQuery>(query);
+			checks.emplace_back(constantConditionQuery.constraints && constantConditionQuery.value, vector<smtutil::Expression>{});
+			checks.emplace_back(constantConditionQuery.constraints && !constantConditionQuery.value, vector<smtutil::Expression>{});
+		}
+
+	vector<pair<smtutil::CheckResult, vector<string>>> results(checks.size());
+	vector<optional<string>> errorMessages(checks.size());
+	vector<exception_ptr> failures = util::parallelFor(checks.size(), m_settings.jobs, [&](size_t _index) {
+		auto const& [assertion, expressionsToEvaluate] = checks[_index];
+		vector<smtutil::Expression> symbols = expressionsToEvaluate;
+		symbols.push_back(assertion);
+		auto solver = portfolio->copy(symbols);
+		solver->addAssertion(assertion);
+		results[_index] = solve(*solver, expressionsToEvaluate, errorMessages[_index]);
+	});
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	size_t checkIndex = 0;
+	auto nextResult = [&]() -> pair<smtutil::CheckResult, vector<string>> const& {
+		if (errorMessages[checkIndex])
+			m_errorReporter.warning(8140_error, *errorMessages[checkIndex]);
+		return results[checkIndex++];
+	};
+	for (auto const& query: *m_deferredQueries)
+		if (auto const* conditionQuery = get_if<ConditionQuery>(&query))
+		{
+			auto const& [result, values] = nextResult();
+			reportCondition(*conditionQuery, result, values);
+		}
+		else
+		{
+			smtutil::CheckResult positiveResult = nextResult().first;
+			smtutil::CheckResult negatedResult = nextResult().first;
+			reportConstantCondition(get<ConstantConditionQuery>(query), positiveResult, negatedResult);
+		}
+}
+
 void BMC::assignment(smt::SymbolicVariable& _symVar, smtutil::Expression const& _value)
 {
 	auto oldVar = _symVar.currentValue();
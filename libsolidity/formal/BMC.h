@@ -38,8 +38,10 @@
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <optional>
 #include <set>
 #include <string>
+#include <variant>
 #include <vector>
 
 using solidity::util::h256;
@@ -154,7 +156,29 @@ private:
 
 	/// Solver related.
 	//@{
+	/// A query created by checkCondition, together with what is needed to report its result.
+	struct ConditionQuery
+	{
+		smtutil::Expression condition;
+		std::vector<smtutil::Expression> expressionsToEvaluate;
+		std::vector<std::string> expressionNames;
+		std::vector<CallStackEntry> callStack;
+		langutil::SourceLocation location;
+		langutil::ErrorId errorHappens;
+		langutil::ErrorId errorMightHappen;
+		std::string description;
+	};
+	/// A query created by checkBooleanNotConstant, together with what is needed to report its result.
+	struct ConstantConditionQuery
+	{
+		Expression const* condition;
+		smtutil::Expression constraints;
+		smtutil::Expression value;
+		std::vector<CallStackEntry> callStack;
+	};
+
 	/// Check that a condition can be satisfied.
+	/// If m_deferredQueries is set, the query is only recorded there.
 	void checkCondition(
 		smtutil::Expression _condition,
 		std::vector<CallStackEntry> const& _callStack,
@@ -168,6 +192,7 @@ private:
 	);
 	/// Checks that a boolean condition is not constant. Do not warn if the expression
 	/// is a literal constant.
+	/// If m_deferredQueries is set, the query is only recorded there.
 	void checkBooleanNotConstant(
 		Expression const& _condition,
 		smtutil::Expression const& _constraints,
@@ -176,12 +201,38 @@ private:
 	);
 	std::pair<smtutil::CheckResult, std::vector<std::string>>
 	checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _expressionsToEvaluate);
+	/// Checks @a _solver and formats the values of the model. If the solver fails, @returns
+	/// an error and sets @a _errorMessage. Does not access any member, so it can be called
+	/// concurrently on different solvers.
+	static std::pair<smtutil::CheckResult, std::vector<std::string>> solve(
+		smtutil::SolverInterface& _solver,
+		std::vector<smtutil::Expression> const& _expressionsToEvaluate,
+		std::optional<std::string>& _errorMessage
+	);
 
 	smtutil::CheckResult checkSatisfiable();
+	void reportCondition(
+		ConditionQuery const& _query,
+		smtutil::CheckResult _result,
+		std::vector<std::string> const& _values
+	);
+	void reportConstantCondition(
+		ConstantConditionQuery const& _query,
+		smtutil::CheckResult _positiveResult,
+		smtutil::CheckResult _negatedResult
+	);
+	/// @returns true if the verification targets are checked concurrently.
+	bool checkInParallel() const;
+	/// Checks the queries in m_deferredQueries on up to m_settings.jobs threads, each on its own
+	/// copy of the solvers, and reports the results in the order of the queries.
+	void checkDeferredQueries();
 	//@}
 
 	std::unique_ptr<smtutil::SolverInterface> m_interface;
 
+	/// Queries of checkCondition and checkBooleanNotConstant that are checked in parallel once all of them are known.
+	std::optional<std::vector<std::variant<ConditionQuery, ConstantConditionQuery>>> m_deferredQueries;
+
 	/// Flags used for better warning messages.
 	bool m_loopExecutionHappened = false;
 	bool m_externalFunctionCallHappened = false;
@@ -31,6 +31,7 @@
 
 #include <libsmtutil/CHCSmtLib2Interface.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
 
 #include <range/v3/algorithm/for_each.hpp>
 
@@ -936,7 +937,7 @@ void CHC::resetSourceAnalysis()
 	if (usesZ3)
 	{
 		/// z3::fixedpoint does not have a reset mechanism, so we need to create another.
-		m_interface.reset(new Z3CHCInterface(m_settings.timeout));
+		m_interface.reset(new Z3CHCInterface(m_settings.timeout, m_settings.jobs > 1));
 		auto z3Interface = dynamic_cast<Z3CHCInterface const*>(m_interface.get());
 		solAssert(z3Interface, "");
 		m_context.setSolver(z3Interface->z3Interface());
@@ -1417,34 +1418,45 @@ void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 }
 
 pair<CheckResult, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+{
+	auto result = solve(*m_interface, _query);
+	reportSolverFailure(result.first, _location);
+	return result;
+}
+
+pair<CheckResult, CHCSolverInterface::CexGraph> CHC::solve(CHCSolverInterface& _solver, smtutil::Expression const& _query)
 {
 	CheckResult result;
 	CHCSolverInterface::CexGraph cex;
-	tie(result, cex) = m_interface->query(_query);
-	switch (result)
-	{
-	case CheckResult::SATISFIABLE:
+	tie(result, cex) = _solver.query(_query);
+	if (result == CheckResult::SATISFIABLE)
 	{
 #ifdef HAVE_Z3
 		// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
 		// We now disable those optimizations and check whether we can still solve the problem.
-		auto* spacer = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+		auto* spacer = dynamic_cast<Z3CHCInterface*>(&_solver);
 		solAssert(spacer, "");
 		spacer->setSpacerOptions(false);
 
 		CheckResult resultNoOpt;
 		CHCSolverInterface::CexGraph cexNoOpt;
-		tie(resultNoOpt, cexNoOpt) = m_interface->query(_query);
+		tie(resultNoOpt, cexNoOpt) = _solver.query(_query);
 
 		if (resultNoOpt == CheckResult::SATISFIABLE)
 			cex = move(cexNoOpt);
 
 		spacer->setSpacerOptions(true);
 #endif
-		break;
 	}
+	return {result, cex};
+}
+
+void CHC::reportSolverFailure(CheckResult _result, langutil::SourceLocation const& _location)
+{
+	switch (_result)
+	{
+	case CheckResult::SATISFIABLE:
 	case CheckResult::UNSATISFIABLE:
-		break;
 	case CheckResult::UNKNOWN:
 		break;
 	case CheckResult::CONFLICTING:
@@ -1454,7 +1466,6 @@ pair<CheckResult, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression c
 		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
 		break;
 	}
-	return {result, cex};
 }
 
 void CHC::verificationTargetEncountered(
@@ -1519,6 +1530,7 @@ void CHC::checkVerificationTargets()
 	}
 
 	set<unsigned> checkedErrorIds;
+	vector<tuple<CHCVerificationTarget const*, ErrorId, string>> targetsToCheck;
 	for (auto const& target: verificationTargets)
 	{
 		string errorType;
@@ -1571,10 +1583,47 @@ void CHC::checkVerificationTargets()
 		else
 			solAssert(false, "");
 
-		checkAndReportTarget(target, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		targetsToCheck.emplace_back(&target, errorReporterId, move(errorType));
 		checkedErrorIds.insert(target.errorId);
 	}
 
+	// All error blocks are created before the first query, so the solver sees the same
+	// clauses for every target, independently of the number of jobs.
+	vector<pair<size_t, smtutil::Expression>> queries;
+	for (size_t index = 0; index < targetsToCheck.size(); ++index)
+	{
+		CHCVerificationTarget const& target = *get<0>(targetsToCheck[index]);
+		if (m_unsafeTargets.count(target.errorNode) && m_unsafeTargets.at(target.errorNode).count(target.type))
+			continue;
+		createErrorBlock();
+		connectBlocks(target.value, error(), target.constraints);
+		queries.emplace_back(index, error());
+	}
+
+	bool parallel = false;
+#ifdef HAVE_Z3
+	parallel = m_settings.jobs > 1 && queries.size() > 1 && dynamic_cast<Z3CHCInterface const*>(m_interface.get());
+#endif
+	if (parallel)
+		checkAndReportTargetsInParallel(targetsToCheck, queries);
+	else
+		for (auto const& [index, errorPredicate]: queries)
+		{
+			auto const& [target, errorReporterId, errorType] = targetsToCheck[index];
+			if (m_unsafeTargets.count(target->errorNode) && m_unsafeTargets.at(target->errorNode).count(target->type))
+				continue;
+			auto const& [result, model] = query(errorPredicate, target->errorNode->location());
+			reportTarget(
+				*target,
+				result,
+				model,
+				errorPredicate.name,
+				errorReporterId,
+				errorType + " happens here.",
+				errorType + " might happen here."
+			);
+		}
+
 	// There can be targets in internal functions that are not reachable from the external interface.
 	// These are safe by definition and are not even checked by the CHC engine, but this information
 	// must still be reported safe by the BMC engine.
@@ -1595,27 +1644,24 @@ void CHC::checkVerificationTargets()
 		m_safeTargets[m_verificationTargets.at(id).errorNode].insert(m_verificationTargets.at(id).type);
 }
 
-void CHC::checkAndReportTarget(
+void CHC::reportTarget(
 	CHCVerificationTarget const& _target,
+	CheckResult _result,
+	CHCSolverInterface::CexGraph const& _model,
+	string const& _errorPredicate,
 	ErrorId _errorReporterId,
-	string _satMsg,
-	string _unknownMsg
+	string const& _satMsg,
+	string const& _unknownMsg
 )
 {
-	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
-		return;
-
-	createErrorBlock();
-	connectBlocks(_target.value, error(), _target.constraints);
 	auto const& location = _target.errorNode->location();
-	auto const& [result, model] = query(error(), location);
-	if (result == CheckResult::UNSATISFIABLE)
+	if (_result == CheckResult::UNSATISFIABLE)
 		m_safeTargets[_target.errorNode].insert(_target.type);
-	else if (result == CheckResult::SATISFIABLE)
+	else if (_result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
 		m_unsafeTargets[_target.errorNode].insert(_target.type);
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(_model, _errorPredicate);
 		if (cex)
 			m_errorReporter.warning(
 				_errorReporterId,
@@ -1637,6 +1683,47 @@ void CHC::checkAndReportTarget(
 		);
 }
 
+void CHC::checkAndReportTargetsInParallel(
+	[[maybe_unused]] vector<tuple<CHCVerificationTarget const*, ErrorId, string>> const& _targets,
+	[[maybe_unused]] vector<pair<size_t, smtutil::Expression>> const& _queries
+)
+{
+#ifdef HAVE_Z3
+	auto const* spacer = dynamic_cast<Z3CHCInterface const*>(m_interface.get());
+	solAssert(spacer, "");
+
+	vector<pair<CheckResult, CHCSolverInterface::CexGraph>> results(_queries.size());
+	vector<exception_ptr> failures = util::parallelFor(_queries.size(), m_settings.jobs, [&](size_t _index) {
+		auto solver = spacer->copy();
+		results[_index] = solve(*solver, _queries[_index].second);
+	});
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	for (size_t index = 0; index < _queries.size(); ++index)
+	{
+		auto const& [target, errorReporterId, errorType] = _targets[_queries[index].first];
+		// As in the sequential case, only the first violation of each target is reported.
+		if (m_unsafeTargets.count(target->errorNode) && m_unsafeTargets.at(target->errorNode).count(target->type))
+			continue;
+		auto const& [result, model] = results[index];
+		reportSolverFailure(result, target->errorNode->location());
+		reportTarget(
+			*target,
+			result,
+			model,
+			_queries[index].second.name,
+			errorReporterId,
+			errorType + " happens here.",
+			errorType + " might happen here."
+		);
+	}
+#else
+	solAssert(false, "");
+#endif
+}
+
 /**
 The counterexample DAG has the following properties:
 1) The root node represents the reachable error predicate.
@@ -44,6 +44,7 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <tuple>
 
 namespace solidity::frontend
 {
@@ -226,6 +227,14 @@ private:
 	/// @returns <true, empty> if query is unsatisfiable (safe).
 	/// @returns <false, model> otherwise.
 	std::pair<smtutil::CheckResult, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Queries @a _solver without reporting anything, see query().
+	/// Does not access any member, so it can be called concurrently on different solvers.
+	static std::pair<smtutil::CheckResult, smtutil::CHCSolverInterface::CexGraph> solve(
+		smtutil::CHCSolverInterface& _solver,
+		smtutil::Expression const& _query
+	);
+	/// Reports a warning at @a _location if @a _result is an error or conflict.
+	void reportSolverFailure(smtutil::CheckResult _result, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -233,11 +242,25 @@ private:
 	// Forward declaration. Definition is below.
 	struct CHCVerificationTarget;
 	void checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target);
-	void checkAndReportTarget(
+	/// Reports the result of querying the error predicate @a _errorPredicate of @a _target.
+	void reportTarget(
 		CHCVerificationTarget const& _target,
+		smtutil::CheckResult _result,
+		smtutil::CHCSolverInterface::CexGraph const& _model,
+		std::string const& _errorPredicate,
 		langutil::ErrorId _errorReporterId,
-		std::string _satMsg,
-		std::string _unknownMsg = ""
+		std::string const& _satMsg,
+		std::string const& _unknownMsg
+	);
+	/// Queries the error predicates in @a _queries, each paired with the index of its target
+	/// in @a _targets, with up to m_settings.jobs queries running concurrently. Each query runs
+	/// on its own copy of all Horn clauses, so unlike the sequential check it does not benefit
+	/// from what the solver learnt in earlier queries. Results are reported in order
+	/// afterwards, so the output does not depend on the scheduling.
+	/// Requires Z3 and an interface that records its clauses.
+	void checkAndReportTargetsInParallel(
+		std::vector<std::tuple<CHCVerificationTarget const*, langutil::ErrorId, std::string>> const& _targets,
+		std::vector<std::pair<size_t, smtutil::Expression>> const& _queries
 	);
 
 	std::optional<std::string> generateCounterexample(smtutil::CHCSolverInterface::CexGraph const& _graph, std::string const& _root);
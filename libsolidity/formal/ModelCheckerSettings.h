@@ -115,6 +115,10 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
 	std::optional<unsigned> timeout;
+	/// Check each BMC query with all solvers concurrently and stop at the first answer.
+	bool raceSolvers = false;
+	/// Number of verification targets that are checked concurrently.
+	unsigned jobs = 1;
 
 	bool operator!=(ModelCheckerSettings const& _other) const noexcept { return !(*this == _other); }
 	bool operator==(ModelCheckerSettings const& _other) const noexcept
@@ -123,7 +127,9 @@ struct ModelCheckerSettings
 			contracts == _other.contracts &&
 			engine == _other.engine &&
 			targets == _other.targets &&
-			timeout == _other.timeout;
+			timeout == _other.timeout &&
+			raceSolvers == _other.raceSolvers &&
+			jobs == _other.jobs;
 	}
 };
 
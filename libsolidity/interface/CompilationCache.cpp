@@ -0,0 +1,223 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/Keccak256.h>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <tuple>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// Extension of entry files. Anything else in the cache directory is left alone.
+string const entryExtension = ".json";
+
+optional<string> readEntry(fs::path const& _path)
+{
+	ifstream stream(_path.string(), ios::binary);
+	if (!stream)
+		return nullopt;
+	string content{istreambuf_iterator<char>(stream), istreambuf_iterator<char>()};
+	if (stream.bad())
+		return nullopt;
+	return content;
+}
+
+}
+
+h256 CompilationCache::key(Json::Value const& _input)
+{
+	Json::Value input = _input;
+	if (input.isObject() && input["settings"].isObject())
+		input["settings"].removeMember("parallelism");
+	return keccak256(VersionString + '\0' + jsonCompactPrint(input));
+}
+
+optional<Json::Value> CompilationCache::lookup(h256 const& _key, ReadCallback::Callback const& _readFile)
+{
+	Json::Value entry;
+	optional<string> content = readEntry(entryPath(_key));
+	bool valid =
+		content &&
+		jsonParseStrict(*content, entry) &&
+		entry.isObject() &&
+		entry["version"] == VersionString &&
+		entry["fileReads"].isArray() &&
+		entry.isMember("output");
+
+	if (valid)
+		for (Json::Value const& fileRead: entry["fileReads"])
+		{
+			if (!_readFile || !fileRead["kind"].isString() || !fileRead["path"].isString())
+			{
+				valid = false;
+				break;
+			}
+			ReadCallback::Result result = _readFile(fileRead["kind"].asString(), fileRead["path"].asString());
+			if (
+				fileRead["success"] != result.success ||
+				fileRead["hash"] != keccak256(result.responseOrErrorMessage).hex()
+			)
+			{
+				valid = false;
+				break;
+			}
+		}
+
+	if (!valid)
+	{
+		++m_stats.misses;
+		return nullopt;
+	}
+
+	// Refresh the modification time, it is what eviction uses to determine the least recently used entries.
+	boost::system::error_code error;
+	fs::last_write_time(entryPath(_key), time(nullptr), error);
+
+	++m_stats.hits;
+	return entry["output"];
+}
+
+void CompilationCache::store(h256 const& _key, Json::Value const& _output, vector<FileRead> const& _fileReads)
+{
+	Json::Value entry{Json::objectValue};
+	entry["version"] = VersionString;
+	entry["fileReads"] = Json::arrayValue;
+	for (FileRead const& fileRead: _fileReads)
+	{
+		Json::Value read{Json::objectValue};
+		read["kind"] = fileRead.kind;
+		read["path"] = fileRead.path;
+		read["success"] = fileRead.success;
+		read["hash"] = fileRead.responseHash.hex();
+		entry["fileReads"].append(move(read));
+	}
+	entry["output"] = _output;
+
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+	if (error)
+		return;
+
+	// Write to a temporary file first and then rename it, so that concurrent compiler
+	// invocations sharing the directory never see partially written entries.
+	fs::path temporaryPath = m_directory / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp", error);
+	if (error)
+		return;
+	{
+		ofstream stream(temporaryPath.string(), ios::binary | ios::trunc);
+		stream << jsonCompactPrint(entry);
+		if (!stream)
+		{
+			stream.close();
+			fs::remove(temporaryPath, error);
+			return;
+		}
+	}
+	fs::rename(temporaryPath, entryPath(_key), error);
+	if (error)
+	{
+		fs::remove(temporaryPath, error);
+		return;
+	}
+
+	++m_stats.stores;
+	evict(_key);
+}
+
+string CompilationCache::formatStats() const
+{
+	size_t entries = 0;
+	uintmax_t totalSize = 0;
+	boost::system::error_code error;
+	for (fs::directory_iterator it(m_directory, error), end; !error && it != end; it.increment(error))
+		if (it->path().extension() == entryExtension)
+		{
+			uintmax_t size = fs::file_size(it->path(), error);
+			if (error)
+				break;
+			++entries;
+			totalSize += size;
+		}
+
+	return
+		"Compilation cache: " +
+		to_string(m_stats.hits) + " hits, " +
+		to_string(m_stats.misses) + " misses, " +
+		to_string(m_stats.stores) + " stores, " +
+		to_string(m_stats.evictions) + " evictions, " +
+		to_string(entries) + " entries using " +
+		to_string(totalSize) + " of " +
+		to_string(m_maxSize) + " bytes.";
+}
+
+fs::path CompilationCache::entryPath(h256 const& _key) const
+{
+	return m_directory / (_key.hex() + entryExtension);
+}
+
+void CompilationCache::evict(h256 const& _keep)
+{
+	// Tuples of modification time, size and path, so that sorting puts the least recently used entry first.
+	vector<tuple<time_t, uintmax_t, fs::path>> entries;
+	uintmax_t totalSize = 0;
+	boost::system::error_code error;
+	for (fs::directory_iterator it(m_directory, error), end; !error && it != end; it.increment(error))
+	{
+		if (it->path().extension() != entryExtension || it->path() == entryPath(_keep))
+			continue;
+		// The entry might have been removed by another process in the meantime.
+		boost::system::error_code sizeError;
+		boost::system::error_code timeError;
+		uintmax_t size = fs::file_size(it->path(), sizeError);
+		time_t lastWriteTime = fs::last_write_time(it->path(), timeError);
+		if (sizeError || timeError)
+			continue;
+		entries.emplace_back(lastWriteTime, size, it->path());
+		totalSize += size;
+	}
+	uintmax_t keptSize = fs::file_size(entryPath(_keep), error);
+	if (!error)
+		totalSize += keptSize;
+	if (totalSize <= m_maxSize)
+		return;
+
+	sort(entries.begin(), entries.end());
+	for (auto const& [lastWriteTime, size, path]: entries)
+	{
+		if (totalSize <= m_maxSize)
+			break;
+		if (fs::remove(path, error))
+			++m_stats.evictions;
+		totalSize -= size;
+	}
+}
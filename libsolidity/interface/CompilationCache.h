@@ -0,0 +1,103 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Persistent, content-addressed cache of Standard JSON compilation results.
+ */
+
+#pragma once
+
+#include <libsolidity/interface/ReadFile.h>
+
+#include <libsolutil/FixedHash.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Stores Standard JSON outputs in a local directory, one file per entry.
+ *
+ * Entries are keyed by the keccak256 hash of the compiler version and the input JSON. Settings that
+ * do not influence the output (currently only "settings.parallelism") are not part of the key.
+ * Since files can also be loaded through the read callback, every entry records the callback
+ * requests made while producing it, together with a hash of the response. A lookup only succeeds
+ * if repeating these requests produces the same responses.
+ *
+ * The total size of the directory is kept below a configurable limit by removing the least
+ * recently used entries after every store. The entry that was just stored is never removed.
+ * All filesystem errors are treated as cache misses, the cache never causes a compilation to fail.
+ */
+class CompilationCache
+{
+public:
+	/// Request made through the read callback while compiling.
+	struct FileRead
+	{
+		std::string kind;
+		std::string path;
+		bool success = false;
+		util::h256 responseHash;
+	};
+
+	struct Stats
+	{
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t stores = 0;
+		size_t evictions = 0;
+	};
+
+	/// @param _directory directory that holds the entries. Created on first store if it does not exist.
+	/// @param _maxSize limit in bytes for the total size of all entries.
+	CompilationCache(boost::filesystem::path _directory, uintmax_t _maxSize):
+		m_directory(std::move(_directory)),
+		m_maxSize(_maxSize)
+	{}
+
+	/// @returns the cache key for the Standard JSON input @a _input.
+	static util::h256 key(Json::Value const& _input);
+
+	/// @returns the cached output for @a _key if there is one and all file reads it depends on
+	/// still produce the same result when performed through @a _readFile.
+	std::optional<Json::Value> lookup(util::h256 const& _key, ReadCallback::Callback const& _readFile);
+
+	/// Stores @a _output under @a _key and evicts old entries if the size limit is exceeded.
+	void store(util::h256 const& _key, Json::Value const& _output, std::vector<FileRead> const& _fileReads);
+
+	Stats const& stats() const { return m_stats; }
+	/// @returns a one-line human-readable summary of the statistics and the current cache size.
+	std::string formatStats() const;
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+	/// Removes least recently used entries other than @a _keep until the total size is at most m_maxSize.
+	void evict(util::h256 const& _keep);
+
+	boost::filesystem::path m_directory;
+	uintmax_t m_maxSize = 0;
+	Stats m_stats;
+};
+
+}
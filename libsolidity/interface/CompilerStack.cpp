@@ -75,6 +75,7 @@
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
 
 #include <json/json.h>
 
@@ -297,6 +298,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_importRemapper.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_parallelism = 1;
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
@@ -632,55 +634,131 @@ bool CompilerStack::compile(State _stopAfter)
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
 
+	vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
+					requestedContracts.push_back(contract);
+
+	// Runs @a _codeGeneration and turns code generation errors into errors reported
+	// via m_errorReporter. @returns false if an error was reported.
+	auto reportCodeGenerationErrors = [&](auto&& _codeGeneration) -> bool
+	{
+		try
+		{
+			_codeGeneration();
+		}
+		catch (Error const& _error)
+		{
+			if (_error.type() != Error::Type::CodeGenerationError)
+				throw;
+			m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+			return false;
+		}
+		catch (UnimplementedFeatureError const& _unimplementedError)
+		{
+			if (
+				SourceLocation const* sourceLocation =
+				boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
+			)
+			{
+				string const* comment = _unimplementedError.comment();
+				m_errorReporter.error(
+					1834_error,
+					Error::Type::CodeGenerationError,
+					*sourceLocation,
+					"Unimplemented feature error" +
+					((comment && !comment->empty()) ? ": " + *comment : string{}) +
+					" in " +
+					_unimplementedError.lineInfo()
+				);
+				return false;
+			}
+			else
+				throw;
+		}
+		return true;
+	};
+
+	// The IR is generated sequentially, because it accesses the AST annotations and
+	// the type provider. Its optimisation and translation to EVM assembly is independent
+	// for every contract (and every sub-object of a contract), though, and is done
+	// concurrently if requested. In that case, the IR of all contracts is generated up to
+	// the first failure before anything is translated, so the failures and the diagnostics
+	// of the IR generation are stored and reported per contract, in the same order and
+	// interleaved with the other diagnostics in the same way as in sequential compilation.
+	// The legacy code generator only optimises the sub-assemblies of each contract concurrently.
+	unique_ptr<util::ThreadPool> threadPool;
+	if (m_parallelism > 1)
+		threadPool = make_unique<util::ThreadPool>(m_parallelism);
+	bool const concurrentEVMFromIR = threadPool && m_viaIR && m_generateEvmBytecode;
+	vector<exception_ptr> irFailures(requestedContracts.size());
+	vector<ErrorList> irDiagnostics(requestedContracts.size());
+	vector<exception_ptr> evmFromIRFailures(requestedContracts.size());
+	if (concurrentEVMFromIR)
+	{
+		size_t generatedIR = 0;
+		while (generatedIR < requestedContracts.size())
+		{
+			size_t const diagnosticsStart = m_errorList.size();
+			try
+			{
+				generateIR(*requestedContracts[generatedIR]);
+			}
+			catch (...)
+			{
+				irFailures[generatedIR] = current_exception();
+			}
+			auto const diagnosticsBegin = m_errorList.begin() + static_cast<ptrdiff_t>(diagnosticsStart);
+			irDiagnostics[generatedIR].assign(diagnosticsBegin, m_errorList.end());
+			m_errorList.erase(diagnosticsBegin, m_errorList.end());
+			// Sequential compilation would not get past a failure.
+			if (irFailures[generatedIR++])
+				break;
+		}
+		vector<exception_ptr> failures = threadPool->parallelFor(
+			generatedIR,
+			[&](size_t _index) {
+				if (!irFailures[_index])
+					generateEVMAssemblyFromIR(*requestedContracts[_index], threadPool.get());
+			}
+		);
+		move(failures.begin(), failures.end(), evmFromIRFailures.begin());
+	}
+
+	for (size_t index = 0; index < requestedContracts.size(); ++index)
+	{
+		ContractDefinition const& contract = *requestedContracts[index];
+		bool success = reportCodeGenerationErrors([&]() {
+			if (concurrentEVMFromIR)
+			{
+				m_errorList += irDiagnostics[index];
+				if (irFailures[index])
+					rethrow_exception(irFailures[index]);
+			}
+			else if (m_viaIR || m_generateIR || m_generateEwasm)
+				generateIR(contract);
+			if (m_generateEvmBytecode)
+			{
+				if (m_viaIR)
 				{
-					try
-					{
-						if (m_viaIR || m_generateIR || m_generateEwasm)
-							generateIR(*contract);
-						if (m_generateEvmBytecode)
-						{
-							if (m_viaIR)
-								generateEVMFromIR(*contract);
-							else
-								compileContract(*contract, otherCompilers);
-						}
-						if (m_generateEwasm)
-							generateEwasm(*contract);
-					}
-					catch (Error const& _error)
-					{
-						if (_error.type() != Error::Type::CodeGenerationError)
-							throw;
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _unimplementedError)
-					{
-						if (
-							SourceLocation const* sourceLocation =
-							boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
-						)
-						{
-							string const* comment = _unimplementedError.comment();
-							m_errorReporter.error(
-								1834_error,
-								Error::Type::CodeGenerationError,
-								*sourceLocation,
-								"Unimplemented feature error" +
-								((comment && !comment->empty()) ? ": " + *comment : string{}) +
-								" in " +
-								_unimplementedError.lineInfo()
-							);
-							return false;
-						}
-						else
-							throw;
-					}
+					if (evmFromIRFailures[index])
+						rethrow_exception(evmFromIRFailures[index]);
+					generateEVMFromIR(contract);
 				}
+				else
+					compileContract(contract, otherCompilers, threadPool.get());
+			}
+			if (m_generateEwasm)
+				generateEwasm(contract);
+		});
+		if (!success)
+			return false;
+	}
+	// The unoptimized Yul objects are only needed while generating the IR of other contracts.
+	for (auto& contract: m_contracts)
+		contract.second.yulIRObject.reset();
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -1295,7 +1373,8 @@ void CompilerStack::assemble(
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	util::ThreadPool* _threadPool
 )
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
@@ -1306,7 +1385,7 @@ void CompilerStack::compileContract(
 		return;
 
 	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _threadPool);
 
 	if (!_contract.canBeDeployed())
 		return;
@@ -1321,7 +1400,7 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Run optimiser and compile the contract.
-		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata, _threadPool);
 	}
 	catch(evmasm::OptimizerException const&)
 	{
@@ -1359,14 +1438,19 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		return;
 
 	map<ContractDefinition const*, string_view const> otherYulSources;
+	map<ContractDefinition const*, shared_ptr<yul::Object const>> otherYulObjects;
 	for (auto const& pair: m_contracts)
+	{
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
+		otherYulObjects.emplace(pair.second.contract, pair.second.yulIRObject);
+	}
 
 	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, sourceIndices());
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(
+	tie(compiledContract.yulIR, compiledContract.yulIROptimized, compiledContract.yulIRObject) = generator.run(
 		_contract,
 		createCBORMetadata(compiledContract),
-		otherYulSources
+		otherYulSources,
+		otherYulObjects
 	);
 }
 
@@ -1384,17 +1468,35 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
+	if (!compiledContract.evmAssembly)
+		generateEVMAssemblyFromIR(_contract);
+	assemble(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+}
+
+void CompilerStack::generateEVMAssemblyFromIR(ContractDefinition const& _contract, util::ThreadPool* _threadPool)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	solAssert(!m_hasError, "");
+
+	if (!_contract.canBeDeployed())
+		return;
+
+	// Only look up existing entries, since m_contracts can be accessed concurrently.
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	solAssert(!compiledContract.yulIROptimized.empty(), "");
+	if (compiledContract.evmAssembly)
+		return;
+
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
 	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	stack.optimize();
+	stack.optimize(_threadPool);
 
 	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
 
 	string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
-	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
-	assemble(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName, _threadPool);
 }
 
 void CompilerStack::generateEwasm(ContractDefinition const& _contract)
@@ -1528,6 +1630,9 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+			// Only included if enabled to keep the metadata of existing settings unchanged.
+			if (m_optimiserSettings.optimizeStackLayout)
+				details["yulDetails"]["stackLayout"] = true;
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps;
 		}
 
@@ -60,6 +60,16 @@ class Scanner;
 }
 
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
+namespace solidity::yul
+{
+struct Object;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -167,6 +177,13 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets the maximum number of threads used to generate EVM code for the requested contracts.
+	/// The output does not depend on this setting. Values smaller than two disable concurrency.
+	/// When compiling via IR, the optimisation of the Yul IR of contracts and their sub-objects and
+	/// its translation to EVM assembly is done concurrently. The legacy code generator only
+	/// optimises the sub-assemblies of a contract concurrently.
+	void setParallelism(size_t _parallelism) { m_parallelism = _parallelism; }
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -375,6 +392,8 @@ private:
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
 		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		/// Unoptimized Yul IR object, only kept during compilation to build the objects of contracts creating this one.
+		std::shared_ptr<yul::Object const> yulIRObject;
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -418,9 +437,11 @@ private:
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// @param _threadPool if given, the sub-assemblies of the contract are optimised concurrently.
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		util::ThreadPool* _threadPool = nullptr
 	);
 
 	/// Generate Yul IR for a single contract.
@@ -431,6 +452,14 @@ private:
 	/// Depends on output generated by generateIR.
 	void generateEVMFromIR(ContractDefinition const& _contract);
 
+	/// Parses the printed optimized Yul IR of a single contract, so that the source locations
+	/// in the assembly and the source maps refer to the irOptimized output, optimises it and
+	/// translates it into EVM assembly, but does not assemble it. Only accesses the given
+	/// contract and is safe to be called concurrently for different contracts.
+	/// If @a _threadPool is given, the sub-objects and sub-assemblies of the contract are optimised concurrently.
+	/// Depends on output generated by generateIR.
+	void generateEVMAssemblyFromIR(ContractDefinition const& _contract, util::ThreadPool* _threadPool = nullptr);
+
 	/// Generate Ewasm representation for a single contract.
 	/// Depends on output generated by generateIR.
 	void generateEwasm(ContractDefinition const& _contract);
@@ -485,6 +514,7 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	size_t m_parallelism = 1;
 	langutil::EVMVersion m_evmVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
@@ -116,6 +116,7 @@ struct OptimiserSettings
 			runCSE == _other.runCSE &&
 			runConstantOptimiser == _other.runConstantOptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
+			optimizeStackLayout == _other.optimizeStackLayout &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
 			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
@@ -139,6 +140,9 @@ struct OptimiserSettings
 	bool runConstantOptimiser = false;
 	/// Perform more efficient stack allocation for variables during code generation from Yul to bytecode.
 	bool optimizeStackAllocation = false;
+	/// Generate bytecode from Yul via a control flow graph with precomputed stack layouts
+	/// instead of assigning stack slots while traversing the code.
+	bool optimizeStackLayout = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
 	/// Sequence of optimisation steps to be performed by Yul optimiser.
@@ -431,13 +431,13 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json::Value> checkModelCheckerSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"contracts", "engine", "targets", "timeout"};
+	static set<string> keys{"contracts", "engine", "jobs", "raceSolvers", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -604,10 +604,12 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 			if (!settings.runYulOptimiser)
 				return formatFatalError("JSONError", "\"Providing yulDetails requires Yul optimizer to be enabled.");
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
+			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "stackLayout", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
 				return *result;
 			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
 				return *error;
+			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackLayout", settings.optimizeStackLayout))
+				return *error;
 			if (auto error = checkOptimizerDetailSteps(details["yulDetails"], "optimizerSteps", settings.yulOptimiserSteps))
 				return *error;
 		}
@@ -777,6 +779,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt() || settings["parallelism"].asUInt() == 0)
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be a positive integer.");
+		ret.parallelism = settings["parallelism"].asUInt();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -974,6 +983,20 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.timeout = modelCheckerSettings["timeout"].asUInt();
 	}
 
+	if (modelCheckerSettings.isMember("raceSolvers"))
+	{
+		if (!modelCheckerSettings["raceSolvers"].isBool())
+			return formatFatalError("JSONError", "settings.modelChecker.raceSolvers must be a Boolean.");
+		ret.modelCheckerSettings.raceSolvers = modelCheckerSettings["raceSolvers"].asBool();
+	}
+
+	if (modelCheckerSettings.isMember("jobs"))
+	{
+		if (!modelCheckerSettings["jobs"].isUInt() || modelCheckerSettings["jobs"].asUInt() == 0)
+			return formatFatalError("JSONError", "settings.modelChecker.jobs must be a positive integer.");
+		ret.modelCheckerSettings.jobs = modelCheckerSettings["jobs"].asUInt();
+	}
+
 	return { std::move(ret) };
 }
 
@@ -986,6 +1009,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setParserErrorRecovery(_inputsAndSettings.parserErrorRecovery);
 	compilerStack.setRemappings(move(_inputsAndSettings.remappings));
@@ -1367,7 +1391,55 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
-	YulStringRepository::reset();
+	if (!m_cache)
+		return compileUncached(_input);
+
+	util::h256 cacheKey = CompilationCache::key(_input);
+	if (optional<Json::Value> cachedOutput = m_cache->lookup(cacheKey, m_readFile))
+		return move(*cachedOutput);
+
+	// Record all requests made through the read callback, the cached output is only
+	// valid as long as they produce the same responses.
+	vector<CompilationCache::FileRead> fileReads;
+	ReadCallback::Callback readFile = m_readFile;
+	if (readFile)
+		m_readFile = [&](string const& _kind, string const& _path) {
+			ReadCallback::Result result = readFile(_kind, _path);
+			fileReads.push_back({_kind, _path, result.success, util::keccak256(result.responseOrErrorMessage)});
+			return result;
+		};
+	Json::Value output = compileUncached(_input);
+	m_readFile = move(readFile);
+
+	// Only outputs whose errors are regular diagnostics of the input are cached. All other
+	// errors stem from exceptions escaping the compiler (internal errors, running out of
+	// memory, exceptions thrown by the read callback, ...), which might be caused by the
+	// environment and must not be returned for later requests.
+	static set<string> const cacheableErrorTypes{
+		"CodeGenerationError",
+		"DeclarationError",
+		"DocstringParsingError",
+		"ParserError",
+		"TypeError",
+		"SyntaxError",
+		"Warning",
+		"JSONError",
+		"IOError"
+	};
+	bool cacheable = true;
+	if (output.isMember("errors"))
+		for (Json::Value const& error: output["errors"])
+			if (!cacheableErrorTypes.count(error["type"].asString()))
+				cacheable = false;
+	if (cacheable)
+		m_cache->store(cacheKey, output, fileReads);
+
+	return output;
+}
+
+Json::Value StandardCompiler::compileUncached(Json::Value const& _input) noexcept
+{
+	YulStringRepository::Scope yulStringScope;
 
 	try
 	{
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/CompilerStack.h>
 
 #include <optional>
@@ -51,6 +52,11 @@ public:
 	{
 	}
 
+	/// Makes @a compile() answer inputs it has seen before from @a _cache and store the
+	/// results of all other inputs there. The cache has to outlive this object.
+	/// Pass nullptr to disable caching.
+	void setCache(CompilationCache* _cache) { m_cache = _cache; }
+
 	/// Sets all input parameters according to @a _input which conforms to the standardized input
 	/// format, performs compilation and returns a standardized output.
 	Json::Value compile(Json::Value const& _input) noexcept;
@@ -81,8 +87,12 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
 	};
 
+	/// Performs the actual compilation for @a compile(), bypassing the cache.
+	Json::Value compileUncached(Json::Value const& _input) noexcept;
+
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
@@ -91,6 +101,7 @@ private:
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
+	CompilationCache* m_cache = nullptr;
 };
 
 }
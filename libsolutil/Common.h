@@ -73,11 +73,12 @@ using StringMap = std::map<std::string, std::string>;
 using strings = std::vector<std::string>;
 
 /// Interprets @a _u as a two's complement signed number and returns the resulting s256.
+/// Computes the magnitude in 256 bits (which suffices since s256 stores sign and magnitude
+/// separately) to avoid the allocations of bigint.
 inline s256 u2s(u256 _u)
 {
-	static bigint const c_end = bigint(1) << 256;
 	if (boost::multiprecision::bit_test(_u, 255))
-		return s256(-(c_end - _u));
+		return -s256(~_u + 1);
 	else
 		return s256(_u);
 }
@@ -85,11 +86,10 @@ inline s256 u2s(u256 _u)
 /// @returns the two's complement signed representation of the signed number _u.
 inline u256 s2u(s256 _u)
 {
-	static bigint const c_end = bigint(1) << 256;
 	if (_u >= 0)
 		return u256(_u);
 	else
-		return u256(c_end + _u);
+		return ~u256(-_u) + 1;
 }
 
 inline u256 exp256(u256 _base, u256 _exponent)
@@ -0,0 +1,112 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+ThreadPool::ThreadPool(size_t _threadCount)
+{
+	for (size_t i = 1; i < _threadCount; ++i)
+		m_workers.emplace_back([this]() { work({}); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard lock(m_mutex);
+		m_stopping = true;
+	}
+	m_changed.notify_all();
+	for (thread& worker: m_workers)
+		worker.join();
+}
+
+vector<exception_ptr> ThreadPool::parallelFor(size_t _count, function<void(size_t)> const& _task)
+{
+	vector<exception_ptr> failures(_count);
+	if (m_workers.empty() || _count <= 1)
+	{
+		for (size_t index = 0; index < _count; ++index)
+			try
+			{
+				_task(index);
+			}
+			catch (...)
+			{
+				failures[index] = current_exception();
+			}
+		return failures;
+	}
+
+	// Guarded by m_mutex.
+	size_t unfinished = _count;
+	{
+		lock_guard lock(m_mutex);
+		for (size_t index = 0; index < _count; ++index)
+			m_queue.emplace_back([&, index]() {
+				try
+				{
+					_task(index);
+				}
+				catch (...)
+				{
+					failures[index] = current_exception();
+				}
+				lock_guard taskLock(m_mutex);
+				--unfinished;
+			});
+	}
+	m_changed.notify_all();
+	work([&]() { return unfinished == 0; });
+	return failures;
+}
+
+void ThreadPool::work(function<bool()> const& _done)
+{
+	unique_lock lock(m_mutex);
+	while (true)
+	{
+		m_changed.wait(lock, [&]() {
+			return !m_queue.empty() || (_done ? _done() : m_stopping);
+		});
+		if ((_done && _done()) || m_queue.empty())
+			return;
+		function<void()> task = move(m_queue.front());
+		m_queue.pop_front();
+		lock.unlock();
+		task();
+		// Finishing a task can complete a batch some other thread is waiting for.
+		m_changed.notify_all();
+		lock.lock();
+	}
+}
+
+vector<exception_ptr> util::parallelFor(
+	size_t _count,
+	size_t _maxThreads,
+	function<void(size_t)> const& _task
+)
+{
+	ThreadPool pool(min(_maxThreads, _count));
+	return pool.parallelFor(_count, _task);
+}
@@ -0,0 +1,83 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers to run independent pieces of work concurrently.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Fixed set of worker threads that execute batches of independent tasks.
+ *
+ * Tasks may themselves submit batches to the same pool: a thread waiting for its batch to
+ * finish does not block, but keeps executing pending tasks (of any batch) in the meantime.
+ * Because of that, nested parallelism (e.g. contracts whose sub-objects are optimised in
+ * parallel) never needs more than the configured number of threads and cannot deadlock.
+ */
+class ThreadPool
+{
+public:
+	/// Creates a pool that runs tasks on up to @a _threadCount threads, including the thread
+	/// that submits a batch, i.e. it starts @a _threadCount - 1 worker threads.
+	explicit ThreadPool(size_t _threadCount);
+	~ThreadPool();
+
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	/// Calls @a _task for every index in [0, _count) and waits until all calls have finished.
+	/// Indices are started in increasing order.
+	/// Exceptions do not escape the worker threads. Instead, the exception thrown for each index
+	/// (or nullptr if there was none) is returned, so that the caller can report failures
+	/// in a deterministic order independent of the scheduling.
+	std::vector<std::exception_ptr> parallelFor(size_t _count, std::function<void(size_t)> const& _task);
+
+private:
+	/// Runs queued tasks until @a _done returns true (checked with m_mutex held)
+	/// or, if @a _done is empty, until the pool is destroyed.
+	void work(std::function<bool()> const& _done);
+
+	std::mutex m_mutex;
+	std::condition_variable m_changed;
+	std::deque<std::function<void()>> m_queue;
+	bool m_stopping = false;
+	std::vector<std::thread> m_workers;
+};
+
+/// Calls @a _task for every index in [0, _count), using at most @a _maxThreads threads
+/// (including the calling thread). See ThreadPool::parallelFor.
+/// If @a _maxThreads is at most one, all tasks are run sequentially on the calling thread.
+std::vector<std::exception_ptr> parallelFor(
+	size_t _count,
+	size_t _maxThreads,
+	std::function<void(size_t)> const& _task
+);
+
+}
@@ -26,7 +26,11 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
@@ -69,16 +73,273 @@ Whiskers& Whiskers::operator()(
 	return *this;
 }
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// Parsed form of a template. All views point into `source`.
+struct ParsedTemplate
+{
+	struct Part
+	{
+		enum class Kind { Text, Parameter, List, Condition, StringCondition };
+		Kind kind;
+		/// The literal text or the name of the parameter (without the "+" of string conditions).
+		string_view text;
+		/// Index of the block that forms the body of a list or the true-branch of a condition.
+		size_t body = 0;
+		/// Index of the block that forms the false-branch of a condition, if there is one.
+		size_t elseBody = 0;
+		bool hasElse = false;
+	};
+	/// A sequence of parts parsed from the substring `source` of the template.
+	struct Block
+	{
+		string_view source;
+		vector<Part> parts;
+	};
+
+	explicit ParsedTemplate(string _source): source(move(_source))
+	{
+		parseBlock(string_view(source));
+	}
+
+	/// Parses @a _source into a new block and @returns its index.
+	/// Lists and conditions extend to the first matching closing tag. Tags that are not
+	/// well-formed or not closed are kept as literal text.
+	size_t parseBlock(string_view _source)
+	{
+		size_t index = blocks.size();
+		blocks.push_back({_source, {}});
+		vector<Part> parts;
+		auto appendText = [&](string_view _text) {
+			if (_text.empty())
+				return;
+			if (
+				!parts.empty() &&
+				parts.back().kind == Part::Kind::Text &&
+				parts.back().text.data() + parts.back().text.size() == _text.data()
+			)
+				parts.back().text = string_view(parts.back().text.data(), parts.back().text.size() + _text.size());
+			else
+				parts.push_back({Part::Kind::Text, _text});
+		};
+
+		size_t position = 0;
+		while (position < _source.size())
+		{
+			size_t tagStart = _source.find('<', position);
+			if (tagStart == string_view::npos)
+				break;
+			appendText(_source.substr(position, tagStart - position));
+			position = tagStart + 1;
+			if (position == _source.size())
+			{
+				appendText(_source.substr(tagStart, 1));
+				break;
+			}
+
+			char prefix = _source[position];
+			bool isList = prefix == '#';
+			bool isCondition = prefix == '?';
+			size_t nameStart = position + ((isList || isCondition) ? 1 : 0);
+			bool isStringCondition = isCondition && nameStart < _source.size() && _source[nameStart] == '+';
+			if (isStringCondition)
+				nameStart++;
+			size_t nameEnd = nameStart;
+			while (nameEnd < _source.size() && isParameterCharacter(_source[nameEnd]))
+				nameEnd++;
+			if (nameEnd == nameStart || nameEnd == _source.size() || _source[nameEnd] != '>')
+			{
+				appendText(_source.substr(tagStart, 1));
+				continue;
+			}
+			string_view name = _source.substr(nameStart, nameEnd - nameStart);
+			size_t bodyStart = nameEnd + 1;
+
+			if (!isList && !isCondition)
+			{
+				parts.push_back({Part::Kind::Parameter, name});
+				position = bodyStart;
+				continue;
+			}
+
+			// Name including the "+" of string conditions, as it appears in the other tags.
+			string tagName = string(isStringCondition ? "+" : "") + string(name);
+			size_t closeTag = _source.find("</" + tagName + ">", bodyStart);
+			if (closeTag == string_view::npos)
+			{
+				appendText(_source.substr(tagStart, 1));
+				continue;
+			}
+			Part part{
+				isList ? Part::Kind::List : isStringCondition ? Part::Kind::StringCondition : Part::Kind::Condition,
+				name
+			};
+			size_t bodyEnd = closeTag;
+			size_t elseBodyStart = closeTag;
+			if (isCondition)
+			{
+				string elseTag = "<!" + tagName + ">";
+				size_t elseStart = _source.substr(0, closeTag).find(elseTag, bodyStart);
+				if (elseStart != string_view::npos)
+				{
+					bodyEnd = elseStart;
+					elseBodyStart = elseStart + elseTag.size();
+					part.hasElse = true;
+				}
+			}
+			part.body = parseBlock(_source.substr(bodyStart, bodyEnd - bodyStart));
+			if (part.hasElse)
+				part.elseBody = parseBlock(_source.substr(elseBodyStart, closeTag - elseBodyStart));
+			parts.push_back(part);
+			position = closeTag + tagName.size() + 3;
+		}
+		if (position < _source.size())
+			appendText(_source.substr(position));
+		blocks[index].parts = move(parts);
+		return index;
+	}
+
+	string const source;
+	/// The first block is the whole template.
+	vector<Block> blocks;
+};
+
+/// @returns the parsed form of @a _template. Templates are mostly string literals, so the
+/// parsed forms are cached. The cache is cleared once it grows too large, in order to bound
+/// the memory used for templates that are generated dynamically.
+shared_ptr<ParsedTemplate const> parseTemplate(string const& _template)
+{
+	static size_t const maxCachedTemplates = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string_view, shared_ptr<ParsedTemplate const>> cache;
+
+	lock_guard<mutex> lock(cacheMutex);
+	if (auto it = cache.find(_template); it != cache.end())
+		return it->second;
+	if (cache.size() >= maxCachedTemplates)
+		cache.clear();
+	auto parsed = make_shared<ParsedTemplate const>(_template);
+	// The key points into the cached template itself.
+	cache.emplace(string_view(parsed->source), parsed);
+	return parsed;
+}
+
+struct Renderer
+{
+	void render(size_t _blockIndex, Whiskers::StringMap const* _listElement, bool _listsAvailable)
+	{
+		ParsedTemplate::Block const& block = parsed.blocks[_blockIndex];
+		for (ParsedTemplate::Part const& part: block.parts)
+			switch (part.kind)
+			{
+			case ParsedTemplate::Part::Kind::Text:
+				output.append(part.text);
+				break;
+			case ParsedTemplate::Part::Kind::Parameter:
+			{
+				string const* value = parameter(part.text, _listElement);
+				assertThrow(
+					value,
+					WhiskersError,
+					"Value for tag " + string(part.text) + " not provided.\n" +
+					"Template:\n" +
+					string(block.source)
+				);
+				output.append(*value);
+				break;
+			}
+			case ParsedTemplate::Part::Kind::List:
+			{
+				auto list = _listsAvailable ? listParameters.find(string(part.text)) : listParameters.end();
+				assertThrow(
+					list != listParameters.end(),
+					WhiskersError, "List parameter " + string(part.text) + " not set."
+				);
+				for (Whiskers::StringMap const& element: list->second)
+				{
+					for (auto const& value: element)
+						assertThrow(!parameters.count(value.first), WhiskersError, "Parameter collision");
+					// Lists cannot be nested.
+					render(part.body, &element, false);
+				}
+				break;
+			}
+			case ParsedTemplate::Part::Kind::StringCondition:
+			{
+				string const* value = parameter(part.text, _listElement);
+				assertThrow(
+					value,
+					WhiskersError, "Tag " + string(part.text) + " used as condition but was not set."
+				);
+				renderBranch(part, !value->empty(), _listElement, _listsAvailable);
+				break;
+			}
+			case ParsedTemplate::Part::Kind::Condition:
+			{
+				auto condition = conditions.find(string(part.text));
+				assertThrow(
+					condition != conditions.end(),
+					WhiskersError, "Condition parameter " + string(part.text) + " not set."
+				);
+				renderBranch(part, condition->second, _listElement, _listsAvailable);
+				break;
+			}
+			}
+	}
+
+	void renderBranch(ParsedTemplate::Part const& _part, bool _condition, Whiskers::StringMap const* _listElement, bool _listsAvailable)
+	{
+		if (_condition)
+			render(_part.body, _listElement, _listsAvailable);
+		else if (_part.hasElse)
+			render(_part.elseBody, _listElement, _listsAvailable);
+	}
+
+	/// @returns the value of the regular parameter @a _name, which can also be a parameter of the
+	/// current list element @a _listElement, or nullptr if it is not set.
+	string const* parameter(string_view _name, Whiskers::StringMap const* _listElement) const
+	{
+		string name(_name);
+		if (_listElement)
+			if (auto it = _listElement->find(name); it != _listElement->end())
+				return &it->second;
+		if (auto it = parameters.find(name); it != parameters.end())
+			return &it->second;
+		return nullptr;
+	}
+
+	ParsedTemplate const& parsed;
+	Whiskers::StringMap const& parameters;
+	map<string, bool> const& conditions;
+	Whiskers::StringListMap const& listParameters;
+	string output;
+};
+
+}
+
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	shared_ptr<ParsedTemplate const> parsed = parseTemplate(m_template);
+	Renderer renderer{*parsed, m_parameters, m_conditions, m_listParameters, {}};
+	renderer.output.reserve(m_template.size());
+	renderer.render(0, nullptr, true);
+	return move(renderer.output);
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -115,116 +376,3 @@ void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string
 		);
 	}
 }
-
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
-{
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
-		{
-			assertThrow(
-				_parameters.count(tagName),
-				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
-				"Template:\n" +
-				_template
-			);
-			return _parameters.at(tagName);
-		}
-		else if (!listName.empty())
-		{
-			string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
-		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			bool conditionValue = false;
-			if (conditionName[0] == '+')
-			{
-				string tag = conditionName.substr(1);
-				assertThrow(
-					_parameters.count(tag),
-					WhiskersError, "Tag " + tag + " used as condition but was not set."
-				);
-				conditionValue = !_parameters.at(tag).empty();
-			}
-			else
-			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
-			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
-		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
-}
-
@@ -39,9 +39,19 @@ struct DebugData
 {
 	explicit DebugData(langutil::SourceLocation _location): location(std::move(_location)) {}
 	langutil::SourceLocation location;
+	/// @returns debug data for @a _location. Debug data without a location is immutable and
+	/// identical for all nodes, so a single shared instance is returned for it.
 	static std::shared_ptr<DebugData const> create(langutil::SourceLocation _location = {})
 	{
-		return std::make_shared<DebugData const>(_location);
+		if (!_location.isValid())
+			return empty();
+		return std::make_shared<DebugData const>(std::move(_location));
+	}
+	static std::shared_ptr<DebugData const> const& empty()
+	{
+		static std::shared_ptr<DebugData const> const emptyDebugData =
+			std::make_shared<DebugData const>(langutil::SourceLocation{});
+		return emptyDebugData;
 	}
 };
 
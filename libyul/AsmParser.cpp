@@ -51,9 +51,11 @@ shared_ptr<DebugData const> updateLocationEndFrom(
 	langutil::SourceLocation const& _location
 )
 {
+	if (_debugData->location.end == _location.end)
+		return _debugData;
 	SourceLocation updatedLocation = _debugData->location;
 	updatedLocation.end = _location.end;
-	return make_shared<DebugData const>(updatedLocation);
+	return DebugData::create(move(updatedLocation));
 }
 
 optional<int> toInt(string const& _value)
@@ -59,7 +59,7 @@ public:
 		ParserBase(_errorReporter),
 		m_dialect(_dialect),
 		m_locationOverride{_locationOverride ? *_locationOverride : langutil::SourceLocation{}},
-		m_debugDataOverride{},
+		m_debugDataOverride{_locationOverride ? DebugData::create(*_locationOverride) : nullptr},
 		m_useSourceLocationFrom{
 			_locationOverride ?
 			UseSourceLocationFrom::LocationOverride :
@@ -106,7 +106,6 @@ protected:
 			case UseSourceLocationFrom::Scanner:
 				return DebugData::create(ParserBase::currentLocation());
 			case UseSourceLocationFrom::LocationOverride:
-				return DebugData::create(m_locationOverride);
 			case UseSourceLocationFrom::Comments:
 				return m_debugDataOverride;
 		}
@@ -38,6 +38,7 @@
 
 #include <libevmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
+#include <libsolutil/Parallel.h>
 #include <optional>
 
 using namespace std;
@@ -108,7 +109,19 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 	return analyzeParsed();
 }
 
-void AssemblyStack::optimize()
+bool AssemblyStack::analyze(shared_ptr<Object> _object)
+{
+	yulAssert(_object, "");
+	yulAssert(_object->code, "");
+	m_errors.clear();
+	m_analysisSuccessful = false;
+	m_scanner.reset();
+	m_parserResult = move(_object);
+
+	return analyzeParsed();
+}
+
+void AssemblyStack::optimize(util::ThreadPool* _threadPool)
 {
 	if (!m_optimiserSettings.runYulOptimiser)
 		return;
@@ -117,7 +130,7 @@ void AssemblyStack::optimize()
 
 	m_analysisSuccessful = false;
 	yulAssert(m_parserResult, "");
-	optimize(*m_parserResult, true);
+	optimize(*m_parserResult, true, _threadPool);
 	yulAssert(analyzeParsed(), "Invalid source code after optimization.");
 }
 
@@ -182,18 +195,39 @@ void AssemblyStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) cons
 			break;
 	}
 
-	EVMObjectCompiler::compile(*m_parserResult, _assembly, *dialect, _optimize);
+	EVMObjectCompiler::compile(
+		*m_parserResult,
+		_assembly,
+		*dialect,
+		_optimize,
+		m_optimiserSettings.optimizeStackLayout
+	);
 }
 
-void AssemblyStack::optimize(Object& _object, bool _isCreation)
+void AssemblyStack::optimize(Object& _object, bool _isCreation, util::ThreadPool* _threadPool)
 {
 	yulAssert(_object.code, "");
 	yulAssert(_object.analysisInfo, "");
+
+	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
+
+	// Sub-objects do not share any code, so they can be optimised independently of each other.
+	// The object itself is only optimised after all of them, since it refers to their names.
+	vector<Object*> subObjects;
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
-			optimize(*subObject, false);
+			subObjects.emplace_back(subObject);
+	auto optimizeSubObject = [&](size_t _index) { optimize(*subObjects[_index], false, _threadPool); };
+	if (_threadPool)
+	{
+		for (exception_ptr const& failure: _threadPool->parallelFor(subObjects.size(), optimizeSubObject))
+			if (failure)
+				rethrow_exception(failure);
+	}
+	else
+		for (size_t index = 0; index < subObjects.size(); ++index)
+			optimizeSubObject(index);
 
-	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
 	unique_ptr<GasMeter> meter;
 	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
 		meter = make_unique<GasMeter>(*evmDialect, _isCreation, m_optimiserSettings.expectedExecutionsPerDeployment);
@@ -204,7 +238,8 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		m_optimiserSettings.optimizeStackAllocation,
 		m_optimiserSettings.yulOptimiserSteps,
 		_isCreation ? nullopt : make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		_threadPool
 	);
 }
 
@@ -270,7 +305,7 @@ AssemblyStack::assembleWithDeployed(optional<string_view> _deployName) const
 }
 
 std::pair<std::shared_ptr<evmasm::Assembly>, std::shared_ptr<evmasm::Assembly>>
-AssemblyStack::assembleEVMWithDeployed(optional<string_view> _deployName) const
+AssemblyStack::assembleEVMWithDeployed(optional<string_view> _deployName, util::ThreadPool* _threadPool) const
 {
 	yulAssert(m_analysisSuccessful, "");
 	yulAssert(m_parserResult, "");
@@ -281,7 +316,7 @@ AssemblyStack::assembleEVMWithDeployed(optional<string_view> _deployName) const
 	EthAssemblyAdapter adapter(assembly);
 	compileEVM(adapter, m_optimiserSettings.optimizeStackAllocation);
 
-	assembly.optimise(translateOptimiserSettings(m_optimiserSettings, m_evmVersion));
+	assembly.optimise(translateOptimiserSettings(m_optimiserSettings, m_evmVersion), _threadPool);
 
 	optional<size_t> subIndex;
 
@@ -45,6 +45,11 @@ namespace solidity::langutil
 class Scanner;
 }
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
 namespace solidity::yul
 {
 class AbstractAssembly;
@@ -84,9 +89,16 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Runs the analysis step on an object that was constructed without going through the parser,
+	/// returns false if it cannot be assembled. The object's code can be from any number of sources.
+	/// Multiple calls overwrite the previous state.
+	bool analyze(std::shared_ptr<Object> _object);
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
-	void optimize();
+	/// If @a _threadPool is given, sibling sub-objects are optimised concurrently on it.
+	/// The result does not depend on whether a thread pool is used.
+	void optimize(util::ThreadPool* _threadPool = nullptr);
 
 	/// Translate the source to a different language / dialect.
 	void translate(Language _targetLanguage);
@@ -106,9 +118,11 @@ public:
 	/// Run the assembly step (should only be called after parseAndAnalyze).
 	/// Similar to @a assemblyWithDeployed, but returns EVM assembly objects.
 	/// Only available for EVM.
+	/// If @a _threadPool is given, the sub-assemblies are optimised concurrently.
 	std::pair<std::shared_ptr<evmasm::Assembly>, std::shared_ptr<evmasm::Assembly>>
 	assembleEVMWithDeployed(
-		std::optional<std::string_view> _deployName = {}
+		std::optional<std::string_view> _deployName = {},
+		util::ThreadPool* _threadPool = nullptr
 	) const;
 
 	/// @returns the errors generated during parsing, analysis (and potentially assembly).
@@ -126,7 +140,7 @@ private:
 
 	void compileEVM(yul::AbstractAssembly& _assembly, bool _optimize) const;
 
-	void optimize(yul::Object& _object, bool _isCreation);
+	void optimize(yul::Object& _object, bool _isCreation, util::ThreadPool* _threadPool);
 
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
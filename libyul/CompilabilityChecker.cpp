@@ -22,10 +22,13 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/optimiser/ASTCopier.h>
 
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
+#include <liblangutil/ErrorReporter.h>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -36,13 +39,72 @@ CompilabilityChecker::CompilabilityChecker(
 	Object const& _object,
 	bool _optimizeStackAllocation
 )
+{
+	check(_dialect, _object, *_object.code, _optimizeStackAllocation);
+}
+
+CompilabilityChecker::CompilabilityChecker(
+	Dialect const& _dialect,
+	Object const& _object,
+	bool _optimizeStackAllocation,
+	set<YulString> const& _functionsToCheck
+)
+{
+	Block const& code = *_object.code;
+	yulAssert(
+		!code.statements.empty() && holds_alternative<Block>(code.statements.front()),
+		"Need to run the function grouper before checking individual functions."
+	);
+
+	// Code is generated for each function independently of the bodies of the other functions,
+	// so it suffices to keep their signatures.
+	Block reducedCode{code.debugData, {}};
+	reducedCode.statements.reserve(code.statements.size());
+	Block const& mainBlock = std::get<Block>(code.statements.front());
+	if (_functionsToCheck.count({}))
+		reducedCode.statements.emplace_back(ASTCopier{}.translate(mainBlock));
+	else
+		reducedCode.statements.emplace_back(Block{mainBlock.debugData, {}});
+	for (size_t i = 1; i < code.statements.size(); ++i)
+	{
+		auto const& function = std::get<FunctionDefinition>(code.statements[i]);
+		if (_functionsToCheck.count(function.name))
+			reducedCode.statements.emplace_back(ASTCopier{}.translate(code.statements[i]));
+		else
+			reducedCode.statements.emplace_back(FunctionDefinition{
+				function.debugData,
+				function.name,
+				function.parameters,
+				function.returnVariables,
+				Block{function.body.debugData, {}}
+			});
+	}
+
+	check(_dialect, _object, reducedCode, _optimizeStackAllocation);
+}
+
+void CompilabilityChecker::check(
+	Dialect const& _dialect,
+	Object const& _object,
+	Block const& _code,
+	bool _optimizeStackAllocation
+)
 {
 	if (auto const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		NoOutputEVMDialect noOutputDialect(*evmDialect);
 
-		yul::AsmAnalysisInfo analysisInfo =
-			yul::AsmAnalyzer::analyzeStrictAssertCorrect(noOutputDialect, _object);
+		yul::AsmAnalysisInfo analysisInfo;
+		langutil::ErrorList errorList;
+		langutil::ErrorReporter errors(errorList);
+		bool success = yul::AsmAnalyzer(
+			analysisInfo,
+			errors,
+			noOutputDialect,
+			{},
+			_object.qualifiedDataNames()
+		).analyze(_code);
+		yulAssert(success && !errors.hasErrors(), "Invalid assembly/yul code.");
 
 		BuiltinContext builtinContext;
 		builtinContext.currentObject = &_object;
@@ -54,12 +116,12 @@ CompilabilityChecker::CompilabilityChecker(
 		CodeTransform transform(
 			assembly,
 			analysisInfo,
-			*_object.code,
+			_code,
 			noOutputDialect,
 			builtinContext,
 			_optimizeStackAllocation
 		);
-		transform(*_object.code);
+		transform(_code);
 
 		for (StackTooDeepError const& error: transform.stackErrors())
 		{
@@ -27,6 +27,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 
 namespace solidity::yul
 {
@@ -45,8 +46,21 @@ namespace solidity::yul
 struct CompilabilityChecker
 {
 	CompilabilityChecker(Dialect const& _dialect, Object const& _object, bool _optimizeStackAllocation);
+	/// Only checks the functions in @a _functionsToCheck, where the empty name denotes the
+	/// outermost block. The other functions are replaced by functions with an empty body, so
+	/// the effort only depends on the size of the checked functions.
+	/// Requires the code to be in the form produced by the function grouper.
+	CompilabilityChecker(
+		Dialect const& _dialect,
+		Object const& _object,
+		bool _optimizeStackAllocation,
+		std::set<YulString> const& _functionsToCheck
+	);
 	std::map<YulString, std::set<YulString>> unreachableVariables;
 	std::map<YulString, int> stackDeficit;
+
+private:
+	void check(Dialect const& _dialect, Object const& _object, Block const& _code, bool _optimizeStackAllocation);
 };
 
 }
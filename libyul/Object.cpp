@@ -21,8 +21,10 @@
 
 #include <libyul/Object.h>
 
+#include <libyul/AST.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/ASTCopier.h>
 
 #include <libsolutil/CommonData.h>
 
@@ -119,3 +121,19 @@ vector<size_t> Object::pathToSubObject(YulString _qualifiedName) const
 
 	return path;
 }
+
+shared_ptr<Object> Object::clone() const
+{
+	yulAssert(code, "No code");
+	auto copy = make_shared<Object>();
+	copy->name = name;
+	copy->subId = subId;
+	copy->code = make_shared<Block>(ASTCopier{}.translate(*code));
+	copy->subIndexByName = subIndexByName;
+	for (auto const& subNode: subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			copy->subObjects.emplace_back(subObject->clone());
+		else
+			copy->subObjects.emplace_back(subNode);
+	return copy;
+}
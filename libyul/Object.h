@@ -86,6 +86,10 @@ public:
 	/// The path must not lead to a @a Data object (will throw in that case).
 	std::vector<size_t> pathToSubObject(YulString _qualifiedName) const;
 
+	/// @returns a deep copy of the object and its sub-objects without analysis information.
+	/// Data nodes are shared between the copies, since they are never modified.
+	std::shared_ptr<Object> clone() const;
+
 	/// sub id for object if it is subobject of another object, max value if it is not subobject
 	size_t subId = std::numeric_limits<size_t>::max();
 
@@ -32,6 +32,7 @@ bool Scope::registerVariable(YulString _name, YulType const& _type)
 		return false;
 	Variable variable;
 	variable.type = _type;
+	variable.name = _name;
 	identifiers[_name] = variable;
 	return true;
 }
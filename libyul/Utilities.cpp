@@ -30,7 +30,9 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 using namespace std;
@@ -91,9 +93,29 @@ u256 solidity::yul::valueOfNumberLiteral(Literal const& _literal)
 {
 	yulAssert(_literal.kind == LiteralKind::Number, "Expected number literal!");
 
+	// The optimiser asks for the values of the same literals over and over again and converting
+	// long literals is expensive, so the values are cached per thread. The cache is keyed by the
+	// interned string, so it has to be invalidated whenever the YulString repository is reset.
+	static atomic<size_t> repositoryGeneration{0};
+	static YulStringRepository::ResetCallback const resetCallback{[]() { ++repositoryGeneration; }};
+	struct Cache
+	{
+		size_t generation = 0;
+		unordered_map<YulString, u256> values;
+	};
+	static thread_local Cache cache;
+	if (cache.generation != repositoryGeneration)
+	{
+		cache.values.clear();
+		cache.generation = repositoryGeneration;
+	}
+
+	if (u256 const* value = util::valueOrNullptr(cache.values, _literal.value))
+		return *value;
+
 	std::string const& literalString = _literal.value.str();
 	yulAssert(isValidDecimal(literalString) || isValidHex(literalString), "Invalid number literal!");
-	return u256(literalString);
+	return cache.values[_literal.value] = u256(literalString);
 }
 
 u256 solidity::yul::valueOfStringLiteral(Literal const& _literal)
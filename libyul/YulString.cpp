@@ -0,0 +1,101 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * String abstraction that avoids copies.
+ */
+
+#include <libyul/YulString.h>
+
+#include <optional>
+
+using namespace std;
+using namespace solidity::yul;
+
+YulStringRepository::YulStringRepository()
+{
+	clear();
+}
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(string const& _string)
+{
+	if (_string.empty())
+		return { 0, emptyHash() };
+	uint64_t h = hash(_string);
+	size_t shard = shardOf(h);
+	size_t index = m_shards[shard].findOrInsert(_string, h);
+	return Handle{index * c_shardCount + shard, h};
+}
+
+void YulStringRepository::clear()
+{
+	for (Shard& shard: m_shards)
+		shard.clear();
+	// Reserve ID zero for the empty string.
+	m_shards[0].findOrInsert(string{}, emptyHash());
+}
+
+YulStringRepository::Shard::Shard()
+{
+	for (auto& bucket: m_buckets)
+		bucket.store(nullptr, memory_order_relaxed);
+}
+
+size_t YulStringRepository::Shard::findOrInsert(string const& _string, uint64_t _hash)
+{
+	auto find = [&]() -> optional<size_t>
+	{
+		auto [begin, end] = m_hashToIndex.equal_range(_hash);
+		for (auto it = begin; it != end; ++it)
+			if (at(it->second) == _string)
+				return it->second;
+		return nullopt;
+	};
+
+	{
+		shared_lock lock(m_mutex);
+		if (optional<size_t> index = find())
+			return *index;
+	}
+
+	unique_lock lock(m_mutex);
+	// Another thread might have inserted the string in the meantime.
+	if (optional<size_t> index = find())
+		return *index;
+
+	size_t index = m_size;
+	auto [bucket, offset] = bucketAndOffset(index);
+	string* strings = m_buckets[bucket].load(memory_order_relaxed);
+	if (!strings)
+	{
+		strings = new string[c_firstBucketSize << bucket];
+		m_buckets[bucket].store(strings, memory_order_release);
+	}
+	strings[offset] = _string;
+	++m_size;
+	m_hashToIndex.emplace(_hash, index);
+	return index;
+}
+
+void YulStringRepository::Shard::clear()
+{
+	unique_lock lock(m_mutex);
+	for (auto& bucket: m_buckets)
+		delete[] bucket.exchange(nullptr, memory_order_relaxed);
+	m_size = 0;
+	m_hashToIndex.clear();
+}
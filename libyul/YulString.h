@@ -21,8 +21,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -34,6 +38,9 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+/// The repository can be used concurrently from multiple threads. It is split into shards
+/// (selected by the string hash) that are locked independently, and resolving an ID
+/// does not require any locking at all.
 class YulStringRepository
 {
 public:
@@ -49,26 +56,16 @@ public:
 		return inst;
 	}
 
-	Handle stringToHandle(std::string const& _string)
+	Handle stringToHandle(std::string const& _string);
+	std::string const& idToString(size_t _id) const
 	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		return m_shards[_id % c_shardCount].at(_id / c_shardCount);
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
-		// FNV hash - can be replaced by a better one, e.g. xxhash64
+		// FNV hash. Note that the hash determines the order of YulStrings and thus the
+		// iteration order of many containers in the optimiser, so changing it changes the output.
 		std::uint64_t hash = emptyHash();
 		for (char c: v)
 		{
@@ -80,14 +77,15 @@ public:
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
 	/// Clear the repository.
-	/// Use with care - there cannot be any dangling YulString references.
+	/// Use with care - there cannot be any dangling YulString references and the repository
+	/// must not be used concurrently.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
 	static void reset()
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		instance().clear();
 	}
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
@@ -95,25 +93,89 @@ public:
 	{
 		ResetCallback(std::function<void()> _fun)
 		{
+			std::lock_guard lock(resetCallbacksMutex());
 			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
 		}
 	};
+	/// Resets the repository when it is constructed and again when it is destroyed, so that
+	/// the memory of all YulStrings created inside its scope is released afterwards.
+	/// No YulString created inside the scope may outlive it.
+	struct Scope
+	{
+		Scope() { reset(); }
+		~Scope() { reset(); }
+		Scope(Scope const&) = delete;
+		Scope& operator=(Scope const&) = delete;
+	};
 
 private:
-	YulStringRepository() = default;
+	static constexpr size_t c_shardCount = 16;
+
+	/// Part of the repository containing the strings whose hash falls into one of
+	/// c_shardCount classes. Strings are stored in buckets of exponentially growing size
+	/// that are allocated on demand and never reallocated. Because of that, stored strings never
+	/// move, and they can be read without locking while other threads insert new strings.
+	class Shard
+	{
+	public:
+		Shard();
+		~Shard() { clear(); }
+
+		/// @returns the index of @a _string (with hash @a _hash) inside the shard, inserting it if
+		/// it is not present yet.
+		size_t findOrInsert(std::string const& _string, std::uint64_t _hash);
+		/// @returns the string at @a _index, which must have been returned by findOrInsert.
+		std::string const& at(size_t _index) const
+		{
+			auto [bucket, offset] = bucketAndOffset(_index);
+			return m_buckets[bucket].load(std::memory_order_acquire)[offset];
+		}
+		/// Removes all strings. Must not be called concurrently with any other function.
+		void clear();
+
+	private:
+		static constexpr size_t c_firstBucketSize = 64;
+		static constexpr size_t c_bucketCount = 40;
+
+		/// @returns the bucket and the offset inside the bucket of the string at @a _index.
+		/// Bucket i has size c_firstBucketSize * 2**i.
+		static std::pair<size_t, size_t> bucketAndOffset(size_t _index)
+		{
+			size_t bucket = 0;
+			for (size_t scaled = _index / c_firstBucketSize + 1; scaled > 1; scaled >>= 1)
+				++bucket;
+			return {bucket, _index - c_firstBucketSize * ((size_t(1) << bucket) - 1)};
+		}
+
+		std::array<std::atomic<std::string*>, c_bucketCount> m_buckets;
+		size_t m_size = 0;
+		std::unordered_multimap<std::uint64_t, size_t> m_hashToIndex;
+		mutable std::shared_mutex m_mutex;
+	};
+
+	YulStringRepository();
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+
+	/// The high bits of the FNV hash are well mixed, the low bits are not.
+	static size_t shardOf(std::uint64_t _hash) { return static_cast<size_t>(_hash >> 32) % c_shardCount; }
+
+	void clear();
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
 		static std::vector<std::function<void()>> callbacks;
 		return callbacks;
 	}
+	static std::mutex& resetCallbacksMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// The ID of a string is its index in its shard times c_shardCount plus the shard index.
+	/// The empty string is always stored at index zero of shard zero, i.e. has ID zero.
+	std::array<Shard, c_shardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -0,0 +1,216 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Control flow graph and stack slot definitions used by the CFG-based EVM code transform.
+ */
+
+#pragma once
+
+#include <libyul/AST.h>
+#include <libyul/Scope.h>
+
+#include <libsolutil/Common.h>
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct BuiltinFunctionForEVM;
+
+/// The label pushed as return label before a call to a user-defined function.
+struct FunctionCallReturnLabelSlot
+{
+	FunctionCall const* call = nullptr;
+	bool operator==(FunctionCallReturnLabelSlot const& _rhs) const { return call == _rhs.call; }
+	bool operator<(FunctionCallReturnLabelSlot const& _rhs) const { return call < _rhs.call; }
+	static constexpr bool canBeFreelyGenerated = true;
+};
+/// The return label of the function that is currently being generated.
+/// It is placed below the arguments by the caller and can never be recreated.
+struct FunctionReturnLabelSlot
+{
+	Scope::Function const* function = nullptr;
+	bool operator==(FunctionReturnLabelSlot const& _rhs) const { return function == _rhs.function; }
+	bool operator<(FunctionReturnLabelSlot const& _rhs) const { return function < _rhs.function; }
+	static constexpr bool canBeFreelyGenerated = false;
+};
+/// The current value of a variable.
+struct VariableSlot
+{
+	Scope::Variable const* variable = nullptr;
+	std::shared_ptr<DebugData const> debugData{};
+	bool operator==(VariableSlot const& _rhs) const { return variable == _rhs.variable; }
+	bool operator<(VariableSlot const& _rhs) const { return variable < _rhs.variable; }
+	static constexpr bool canBeFreelyGenerated = false;
+};
+/// A number literal.
+struct LiteralSlot
+{
+	u256 value;
+	std::shared_ptr<DebugData const> debugData{};
+	bool operator==(LiteralSlot const& _rhs) const { return value == _rhs.value; }
+	bool operator<(LiteralSlot const& _rhs) const { return value < _rhs.value; }
+	static constexpr bool canBeFreelyGenerated = true;
+};
+/// The @a index-th return value of a function call that has not yet been assigned to a variable.
+struct TemporarySlot
+{
+	FunctionCall const* call = nullptr;
+	size_t index = 0;
+	bool operator==(TemporarySlot const& _rhs) const { return call == _rhs.call && index == _rhs.index; }
+	bool operator<(TemporarySlot const& _rhs) const
+	{
+		return call == _rhs.call ? index < _rhs.index : call < _rhs.call;
+	}
+	static constexpr bool canBeFreelyGenerated = false;
+};
+/// A slot whose value is irrelevant. In target layouts, it can be filled with anything.
+struct JunkSlot
+{
+	bool operator==(JunkSlot const&) const { return true; }
+	bool operator<(JunkSlot const&) const { return false; }
+	static constexpr bool canBeFreelyGenerated = true;
+};
+using StackSlot = std::variant<FunctionCallReturnLabelSlot, FunctionReturnLabelSlot, VariableSlot, LiteralSlot, TemporarySlot, JunkSlot>;
+/// The stack from bottom to top.
+using Stack = std::vector<StackSlot>;
+
+/// @returns true if @a _slot can be removed from the stack and recreated later by a push.
+inline bool canBeFreelyGenerated(StackSlot const& _slot)
+{
+	return std::visit([](auto const& _typedSlot) { return std::decay_t<decltype(_typedSlot)>::canBeFreelyGenerated; }, _slot);
+}
+
+/**
+ * Control flow graph of a Yul block and the functions defined in it.
+ *
+ * Basic blocks consist of a sequence of operations, each of which consumes its input slots
+ * from the top of the stack and replaces them with its output slots. Expressions are flattened
+ * into operations in evaluation order, so the results of nested function calls are temporary
+ * slots that are consumed by the operation of the enclosing call.
+ */
+struct CFG
+{
+	CFG() = default;
+	CFG(CFG const&) = delete;
+	CFG(CFG&&) = delete;
+	CFG& operator=(CFG const&) = delete;
+	CFG& operator=(CFG&&) = delete;
+
+	struct BuiltinCall
+	{
+		std::shared_ptr<DebugData const> debugData;
+		BuiltinFunctionForEVM const* builtin = nullptr;
+		yul::FunctionCall const* functionCall = nullptr;
+		/// Number of proper arguments, i.e. arguments that are not literal arguments.
+		size_t arguments = 0;
+	};
+	struct FunctionCall
+	{
+		std::shared_ptr<DebugData const> debugData;
+		Scope::Function const* function = nullptr;
+		yul::FunctionCall const* functionCall = nullptr;
+		/// False if the called function never returns, in which case no return label is pushed.
+		bool canContinue = true;
+	};
+	struct Assignment
+	{
+		std::shared_ptr<DebugData const> debugData;
+		/// The variables being assigned to, which also includes variable declarations.
+		std::vector<VariableSlot> variables;
+	};
+
+	struct Operation
+	{
+		/// Slots the operation expects on top of the stack, which are consumed by it.
+		Stack input;
+		/// Slots the operation leaves on top of the stack.
+		Stack output;
+		std::variant<FunctionCall, BuiltinCall, Assignment> operation;
+	};
+
+	struct FunctionInfo;
+	struct BasicBlock
+	{
+		/// The end of the outermost block.
+		struct MainExit {};
+		struct ConditionalJump
+		{
+			std::shared_ptr<DebugData const> debugData;
+			StackSlot condition;
+			BasicBlock* nonZero = nullptr;
+			BasicBlock* zero = nullptr;
+		};
+		struct Jump
+		{
+			std::shared_ptr<DebugData const> debugData;
+			BasicBlock* target = nullptr;
+			/// True for jumps that close a loop.
+			bool backwards = false;
+		};
+		struct FunctionReturn
+		{
+			std::shared_ptr<DebugData const> debugData;
+			FunctionInfo* info = nullptr;
+		};
+		/// The last operation of the block never returns.
+		struct Terminated {};
+
+		std::shared_ptr<DebugData const> debugData;
+		std::vector<BasicBlock*> entries;
+		std::vector<Operation> operations;
+		std::variant<MainExit, Jump, ConditionalJump, FunctionReturn, Terminated> exit = MainExit{};
+	};
+
+	struct FunctionInfo
+	{
+		std::shared_ptr<DebugData const> debugData;
+		Scope::Function const* function = nullptr;
+		YulString name;
+		BasicBlock* entry = nullptr;
+		std::vector<VariableSlot> parameters;
+		std::vector<VariableSlot> returnVariables;
+		bool canContinue = true;
+	};
+
+	/// The entry block of the main code.
+	BasicBlock* entry = nullptr;
+	/// Information about all functions, in order of their definition.
+	std::map<Scope::Function const*, FunctionInfo> functionInfo;
+	std::vector<Scope::Function const*> functions;
+
+	/// Container for blocks, so that they have stable addresses.
+	std::list<BasicBlock> blocks;
+	/// Variables and calls that do not occur in the source, but are introduced while
+	/// lowering switch statements.
+	std::list<Scope::Variable> ghostVariables;
+	std::list<yul::FunctionCall> ghostCalls;
+
+	BasicBlock& makeBlock(std::shared_ptr<DebugData const> _debugData)
+	{
+		return blocks.emplace_back(BasicBlock{std::move(_debugData), {}, {}});
+	}
+};
+
+}
@@ -0,0 +1,524 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Transformation of a Yul AST into a control flow graph.
+ */
+
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/Visitor.h>
+
+#include <range/v3/view/reverse.hpp>
+
+#include <deque>
+#include <set>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace std;
+
+namespace
+{
+
+/// @returns the successors of @a _block.
+vector<CFG::BasicBlock*> successors(CFG::BasicBlock const& _block)
+{
+	return std::visit(util::GenericVisitor{
+		[](CFG::BasicBlock::MainExit const&) { return vector<CFG::BasicBlock*>{}; },
+		[](CFG::BasicBlock::Jump const& _jump) { return vector<CFG::BasicBlock*>{_jump.target}; },
+		[](CFG::BasicBlock::ConditionalJump const& _jump) { return vector<CFG::BasicBlock*>{_jump.nonZero, _jump.zero}; },
+		[](CFG::BasicBlock::FunctionReturn const&) { return vector<CFG::BasicBlock*>{}; },
+		[](CFG::BasicBlock::Terminated const&) { return vector<CFG::BasicBlock*>{}; }
+	}, _block.exit);
+}
+
+/// @returns the index of the first operation in @a _block that never returns, if any.
+optional<size_t> firstTerminatingOperation(CFG const& _graph, CFG::BasicBlock const& _block)
+{
+	for (size_t index = 0; index < _block.operations.size(); ++index)
+		if (std::visit(util::GenericVisitor{
+			[](CFG::BuiltinCall const& _call) { return _call.builtin->controlFlowSideEffects.terminates; },
+			[&](CFG::FunctionCall const& _call) { return !_graph.functionInfo.at(_call.function).canContinue; },
+			[](CFG::Assignment const&) { return false; }
+		}, _block.operations[index].operation))
+			return index;
+	return nullopt;
+}
+
+/// @returns true if a function return can be reached from @a _entry according to the
+/// current knowledge about which functions can continue.
+bool reachesFunctionReturn(CFG const& _graph, CFG::BasicBlock const& _entry)
+{
+	set<CFG::BasicBlock const*> visited{&_entry};
+	deque<CFG::BasicBlock const*> toVisit{&_entry};
+	while (!toVisit.empty())
+	{
+		CFG::BasicBlock const* block = toVisit.front();
+		toVisit.pop_front();
+		if (firstTerminatingOperation(_graph, *block))
+			continue;
+		if (holds_alternative<CFG::BasicBlock::FunctionReturn>(block->exit))
+			return true;
+		for (CFG::BasicBlock* successor: successors(*block))
+			if (visited.insert(successor).second)
+				toVisit.emplace_back(successor);
+	}
+	return false;
+}
+
+/// Determines which functions can continue. Starts with the assumption that no function
+/// can continue and only relaxes it for functions with a reachable function return, which
+/// makes the result precise for recursive functions.
+void determineCanContinue(CFG& _graph)
+{
+	for (auto& [function, info]: _graph.functionInfo)
+		info.canContinue = false;
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (Scope::Function const* function: _graph.functions)
+		{
+			CFG::FunctionInfo& info = _graph.functionInfo.at(function);
+			if (!info.canContinue && reachesFunctionReturn(_graph, *info.entry))
+			{
+				info.canContinue = true;
+				changed = true;
+			}
+		}
+	}
+}
+
+/// Cuts off all blocks after their first operation that does not return, removes unreachable
+/// blocks and fills in the entries of the remaining ones.
+void cutOffUnreachableCode(CFG& _graph)
+{
+	for (CFG::BasicBlock& block: _graph.blocks)
+	{
+		optional<size_t> terminatingOperation = firstTerminatingOperation(_graph, block);
+		for (size_t index = 0; index < block.operations.size(); ++index)
+			if (auto* functionCall = get_if<CFG::FunctionCall>(&block.operations[index].operation))
+				functionCall->canContinue = !terminatingOperation || index < *terminatingOperation;
+		if (!terminatingOperation)
+			continue;
+
+		block.operations.erase(
+			block.operations.begin() + static_cast<ptrdiff_t>(*terminatingOperation) + 1,
+			block.operations.end()
+		);
+		CFG::Operation& operation = block.operations.back();
+		if (holds_alternative<CFG::FunctionCall>(operation.operation))
+		{
+			// No return label is needed for a call that never returns.
+			yulAssert(!operation.input.empty() && holds_alternative<FunctionCallReturnLabelSlot>(operation.input.front()), "");
+			operation.input.erase(operation.input.begin());
+		}
+		operation.output.clear();
+		block.exit = CFG::BasicBlock::Terminated{};
+	}
+
+	set<CFG::BasicBlock const*> reachable;
+	deque<CFG::BasicBlock*> toVisit{_graph.entry};
+	for (Scope::Function const* function: _graph.functions)
+		toVisit.emplace_back(_graph.functionInfo.at(function).entry);
+	for (CFG::BasicBlock* block: toVisit)
+		reachable.insert(block);
+	while (!toVisit.empty())
+	{
+		CFG::BasicBlock* block = toVisit.front();
+		toVisit.pop_front();
+		block->entries.clear();
+		for (CFG::BasicBlock* successor: successors(*block))
+			if (reachable.insert(successor).second)
+				toVisit.emplace_back(successor);
+	}
+	_graph.blocks.remove_if([&](CFG::BasicBlock const& _block) { return !reachable.count(&_block); });
+	for (CFG::BasicBlock& block: _graph.blocks)
+		for (CFG::BasicBlock* successor: successors(block))
+			successor->entries.emplace_back(&block);
+}
+
+}
+
+unique_ptr<CFG> ControlFlowGraphBuilder::build(
+	AsmAnalysisInfo const& _analysisInfo,
+	EVMDialect const& _dialect,
+	Block const& _block
+)
+{
+	auto graph = make_unique<CFG>();
+	graph->entry = &graph->makeBlock(_block.debugData);
+
+	ControlFlowGraphBuilder builder(*graph, _analysisInfo, _dialect);
+	builder.m_currentBlock = graph->entry;
+	builder(_block);
+
+	determineCanContinue(*graph);
+	cutOffUnreachableCode(*graph);
+
+	return graph;
+}
+
+ControlFlowGraphBuilder::ControlFlowGraphBuilder(
+	CFG& _graph,
+	AsmAnalysisInfo const& _analysisInfo,
+	EVMDialect const& _dialect
+):
+	m_graph(_graph),
+	m_info(_analysisInfo),
+	m_dialect(_dialect)
+{
+}
+
+StackSlot ControlFlowGraphBuilder::operator()(Expression const& _expression)
+{
+	return std::visit(*this, _expression);
+}
+
+StackSlot ControlFlowGraphBuilder::operator()(Literal const& _literal)
+{
+	return LiteralSlot{valueOfLiteral(_literal), _literal.debugData};
+}
+
+StackSlot ControlFlowGraphBuilder::operator()(Identifier const& _identifier)
+{
+	return VariableSlot{&lookupVariable(_identifier.name), _identifier.debugData};
+}
+
+StackSlot ControlFlowGraphBuilder::operator()(FunctionCall const& _call)
+{
+	CFG::Operation const& operation = visitFunctionCall(_call);
+	yulAssert(operation.output.size() == 1, "");
+	return operation.output.front();
+}
+
+void ControlFlowGraphBuilder::operator()(VariableDeclaration const& _varDecl)
+{
+	yulAssert(m_currentBlock, "");
+	vector<VariableSlot> variables;
+	for (TypedName const& variable: _varDecl.variables)
+		variables.emplace_back(VariableSlot{&lookupVariable(variable.name), variable.debugData});
+
+	Stack input;
+	if (_varDecl.value)
+		input = visitAssignmentRightHandSide(*_varDecl.value, variables.size());
+	else
+		input = Stack(variables.size(), LiteralSlot{0, _varDecl.debugData});
+	m_currentBlock->operations.emplace_back(CFG::Operation{
+		move(input),
+		Stack(variables.begin(), variables.end()),
+		CFG::Assignment{_varDecl.debugData, variables}
+	});
+}
+
+void ControlFlowGraphBuilder::operator()(Assignment const& _assignment)
+{
+	yulAssert(m_currentBlock, "");
+	vector<VariableSlot> variables;
+	for (Identifier const& variable: _assignment.variableNames)
+		variables.emplace_back(VariableSlot{&lookupVariable(variable.name), variable.debugData});
+
+	Stack input = visitAssignmentRightHandSide(*_assignment.value, variables.size());
+	m_currentBlock->operations.emplace_back(CFG::Operation{
+		move(input),
+		Stack(variables.begin(), variables.end()),
+		CFG::Assignment{_assignment.debugData, variables}
+	});
+}
+
+void ControlFlowGraphBuilder::operator()(ExpressionStatement const& _statement)
+{
+	yulAssert(holds_alternative<FunctionCall>(_statement.expression), "");
+	CFG::Operation const& operation = visitFunctionCall(std::get<FunctionCall>(_statement.expression));
+	yulAssert(operation.output.empty(), "");
+}
+
+void ControlFlowGraphBuilder::operator()(Block const& _block)
+{
+	ScopedSaveAndRestore saveScope(m_scope, m_info.scopes.at(&_block).get());
+	for (auto const& statement: _block.statements)
+		std::visit(*this, statement);
+}
+
+void ControlFlowGraphBuilder::operator()(If const& _if)
+{
+	yulAssert(m_currentBlock, "");
+	StackSlot condition = std::visit(*this, *_if.condition);
+	CFG::BasicBlock& ifBranch = m_graph.makeBlock(_if.body.debugData);
+	CFG::BasicBlock& afterIf = m_graph.makeBlock(_if.debugData);
+	makeConditionalJump(_if.debugData, move(condition), ifBranch, afterIf);
+	m_currentBlock = &ifBranch;
+	(*this)(_if.body);
+	jump(_if.body.debugData, afterIf);
+}
+
+void ControlFlowGraphBuilder::operator()(Switch const& _switch)
+{
+	yulAssert(m_currentBlock, "");
+	yulAssert(!_switch.cases.empty(), "");
+
+	// The value of the switch expression is kept in an artificial variable that is compared
+	// against the value of each case:
+	//   let <ghost> := <expression>
+	//   if eq(<value>, <ghost>) { ... }
+	YulString ghostVariableName("GHOST[" + to_string(m_graph.ghostVariables.size()) + "]");
+	Scope::Variable& ghostVariable = m_graph.ghostVariables.emplace_back(Scope::Variable{{}, ghostVariableName});
+	VariableSlot ghostSlot{&ghostVariable, debugDataOf(*_switch.expression)};
+	StackSlot value = std::visit(*this, *_switch.expression);
+	m_currentBlock->operations.emplace_back(CFG::Operation{
+		Stack{move(value)},
+		Stack{ghostSlot},
+		CFG::Assignment{_switch.debugData, {ghostSlot}}
+	});
+
+	BuiltinFunctionForEVM const* equality = m_dialect.equalityFunction({});
+	yulAssert(equality, "");
+	auto compareWithCase = [&](Case const& _case) -> StackSlot {
+		yulAssert(_case.value, "");
+		FunctionCall const& ghostCall = m_graph.ghostCalls.emplace_back(FunctionCall{
+			_case.debugData,
+			Identifier{_case.debugData, equality->name},
+			{*_case.value, Identifier{_case.debugData, ghostVariableName}}
+		});
+		CFG::Operation const& operation = m_currentBlock->operations.emplace_back(CFG::Operation{
+			Stack{ghostSlot, LiteralSlot{valueOfLiteral(*_case.value), _case.value->debugData}},
+			Stack{TemporarySlot{&ghostCall, 0}},
+			CFG::BuiltinCall{_case.debugData, equality, &ghostCall, 2}
+		});
+		return operation.output.front();
+	};
+
+	CFG::BasicBlock& afterSwitch = m_graph.makeBlock(_switch.debugData);
+	for (size_t index = 0; index + 1 < _switch.cases.size(); ++index)
+	{
+		Case const& switchCase = _switch.cases[index];
+		CFG::BasicBlock& caseBranch = m_graph.makeBlock(switchCase.body.debugData);
+		CFG::BasicBlock& elseBranch = m_graph.makeBlock(_switch.debugData);
+		makeConditionalJump(switchCase.debugData, compareWithCase(switchCase), caseBranch, elseBranch);
+		m_currentBlock = &caseBranch;
+		(*this)(switchCase.body);
+		jump(switchCase.body.debugData, afterSwitch);
+		m_currentBlock = &elseBranch;
+	}
+	Case const& lastCase = _switch.cases.back();
+	if (lastCase.value)
+	{
+		CFG::BasicBlock& caseBranch = m_graph.makeBlock(lastCase.body.debugData);
+		makeConditionalJump(lastCase.debugData, compareWithCase(lastCase), caseBranch, afterSwitch);
+		m_currentBlock = &caseBranch;
+	}
+	(*this)(lastCase.body);
+	jump(lastCase.body.debugData, afterSwitch);
+}
+
+void ControlFlowGraphBuilder::operator()(ForLoop const& _loop)
+{
+	yulAssert(m_currentBlock, "");
+	ScopedSaveAndRestore saveScope(m_scope, m_info.scopes.at(&_loop.pre).get());
+	(*this)(_loop.pre);
+
+	bool constantTrueCondition = false;
+	if (auto const* literal = get_if<Literal>(_loop.condition.get()))
+		constantTrueCondition = valueOfLiteral(*literal) != 0;
+
+	CFG::BasicBlock& loopCondition = m_graph.makeBlock(debugDataOf(*_loop.condition));
+	CFG::BasicBlock& loopBody = m_graph.makeBlock(_loop.body.debugData);
+	CFG::BasicBlock& post = m_graph.makeBlock(_loop.post.debugData);
+	CFG::BasicBlock& afterLoop = m_graph.makeBlock(_loop.debugData);
+
+	ScopedSaveAndRestore saveForLoopInfo(m_forLoopInfo, optional<ForLoopInfo>(ForLoopInfo{&afterLoop, &post}));
+
+	// The backwards jump of a loop with a constant true condition skips the condition.
+	CFG::BasicBlock& loopHead = constantTrueCondition ? loopBody : loopCondition;
+	jump(_loop.debugData, loopHead);
+	if (!constantTrueCondition)
+	{
+		StackSlot condition = std::visit(*this, *_loop.condition);
+		makeConditionalJump(debugDataOf(*_loop.condition), move(condition), loopBody, afterLoop);
+		m_currentBlock = &loopBody;
+	}
+	(*this)(_loop.body);
+	jump(_loop.body.debugData, post);
+	(*this)(_loop.post);
+	jump(_loop.post.debugData, loopHead, true);
+
+	m_currentBlock = &afterLoop;
+}
+
+void ControlFlowGraphBuilder::operator()(Break const& _break)
+{
+	yulAssert(m_forLoopInfo, "");
+	jump(_break.debugData, *m_forLoopInfo->afterLoop);
+	m_currentBlock = &m_graph.makeBlock(_break.debugData);
+}
+
+void ControlFlowGraphBuilder::operator()(Continue const& _continue)
+{
+	yulAssert(m_forLoopInfo, "");
+	jump(_continue.debugData, *m_forLoopInfo->post);
+	m_currentBlock = &m_graph.makeBlock(_continue.debugData);
+}
+
+void ControlFlowGraphBuilder::operator()(Leave const& _leave)
+{
+	yulAssert(m_currentBlock, "");
+	yulAssert(m_currentFunction, "");
+	m_currentBlock->exit = CFG::BasicBlock::FunctionReturn{_leave.debugData, m_currentFunction};
+	m_currentBlock = &m_graph.makeBlock(_leave.debugData);
+}
+
+void ControlFlowGraphBuilder::operator()(FunctionDefinition const& _function)
+{
+	yulAssert(m_scope, "");
+	yulAssert(m_scope->identifiers.count(_function.name), "");
+	Scope::Function const& function = std::get<Scope::Function>(m_scope->identifiers.at(_function.name));
+	Scope* virtualFunctionScope = m_info.scopes.at(m_info.virtualBlocks.at(&_function).get()).get();
+	yulAssert(virtualFunctionScope, "");
+
+	CFG::FunctionInfo info;
+	info.debugData = _function.debugData;
+	info.function = &function;
+	info.name = _function.name;
+	info.entry = &m_graph.makeBlock(_function.body.debugData);
+	for (TypedName const& parameter: _function.parameters)
+		info.parameters.emplace_back(VariableSlot{
+			&std::get<Scope::Variable>(virtualFunctionScope->identifiers.at(parameter.name)),
+			parameter.debugData
+		});
+	for (TypedName const& returnVariable: _function.returnVariables)
+		info.returnVariables.emplace_back(VariableSlot{
+			&std::get<Scope::Variable>(virtualFunctionScope->identifiers.at(returnVariable.name)),
+			returnVariable.debugData
+		});
+	auto [it, inserted] = m_graph.functionInfo.emplace(&function, move(info));
+	yulAssert(inserted, "");
+	m_graph.functions.emplace_back(&function);
+	CFG::FunctionInfo& functionInfo = it->second;
+
+	ControlFlowGraphBuilder builder(m_graph, m_info, m_dialect);
+	builder.m_currentFunction = &functionInfo;
+	builder.m_currentBlock = functionInfo.entry;
+	builder.m_scope = virtualFunctionScope;
+	builder(_function.body);
+	builder.m_currentBlock->exit = CFG::BasicBlock::FunctionReturn{_function.debugData, &functionInfo};
+}
+
+CFG::Operation const& ControlFlowGraphBuilder::visitFunctionCall(FunctionCall const& _call)
+{
+	yulAssert(m_scope, "");
+	yulAssert(m_currentBlock, "");
+
+	// Arguments are evaluated from right to left, so that the first argument ends up on top of the stack.
+	if (BuiltinFunctionForEVM const* builtin = m_dialect.builtin(_call.functionName.name))
+	{
+		Stack input;
+		for (size_t index = _call.arguments.size(); index > 0; --index)
+			if (!builtin->literalArgument(index - 1))
+				input.emplace_back(std::visit(*this, _call.arguments[index - 1]));
+		Stack output;
+		for (size_t index = 0; index < builtin->returns.size(); ++index)
+			output.emplace_back(TemporarySlot{&_call, index});
+		size_t arguments = input.size();
+		return m_currentBlock->operations.emplace_back(CFG::Operation{
+			move(input),
+			move(output),
+			CFG::BuiltinCall{_call.debugData, builtin, &_call, arguments}
+		});
+	}
+	else
+	{
+		Scope::Function const& function = lookupFunction(_call.functionName.name);
+		yulAssert(function.arguments.size() == _call.arguments.size(), "");
+		Stack input{FunctionCallReturnLabelSlot{&_call}};
+		for (Expression const& argument: _call.arguments | ranges::views::reverse)
+			input.emplace_back(std::visit(*this, argument));
+		Stack output;
+		for (size_t index = 0; index < function.returns.size(); ++index)
+			output.emplace_back(TemporarySlot{&_call, index});
+		return m_currentBlock->operations.emplace_back(CFG::Operation{
+			move(input),
+			move(output),
+			CFG::FunctionCall{_call.debugData, &function, &_call}
+		});
+	}
+}
+
+Stack ControlFlowGraphBuilder::visitAssignmentRightHandSide(Expression const& _expression, size_t _expectedValues)
+{
+	if (auto const* call = get_if<FunctionCall>(&_expression))
+	{
+		Stack output = visitFunctionCall(*call).output;
+		yulAssert(output.size() == _expectedValues, "");
+		return output;
+	}
+	yulAssert(_expectedValues == 1, "");
+	return {std::visit(*this, _expression)};
+}
+
+Scope::Function const& ControlFlowGraphBuilder::lookupFunction(YulString _name) const
+{
+	Scope::Function const* function = nullptr;
+	yulAssert(m_scope->lookup(_name, util::GenericVisitor{
+		[](Scope::Variable&) { yulAssert(false, "Expected function name."); },
+		[&](Scope::Function& _function) { function = &_function; }
+	}), "Function name not found.");
+	yulAssert(function, "");
+	return *function;
+}
+
+Scope::Variable const& ControlFlowGraphBuilder::lookupVariable(YulString _name) const
+{
+	yulAssert(m_scope, "");
+	Scope::Variable const* variable = nullptr;
+	yulAssert(m_scope->lookup(_name, util::GenericVisitor{
+		[&](Scope::Variable& _variable) { variable = &_variable; },
+		[](Scope::Function&) { yulAssert(false, "Expected variable name."); }
+	}), "Variable name not found.");
+	yulAssert(variable, "");
+	return *variable;
+}
+
+void ControlFlowGraphBuilder::makeConditionalJump(
+	shared_ptr<DebugData const> _debugData,
+	StackSlot _condition,
+	CFG::BasicBlock& _nonZero,
+	CFG::BasicBlock& _zero
+)
+{
+	yulAssert(m_currentBlock, "");
+	m_currentBlock->exit = CFG::BasicBlock::ConditionalJump{
+		move(_debugData),
+		move(_condition),
+		&_nonZero,
+		&_zero
+	};
+	m_currentBlock = nullptr;
+}
+
+void ControlFlowGraphBuilder::jump(shared_ptr<DebugData const> _debugData, CFG::BasicBlock& _target, bool _backwards)
+{
+	yulAssert(m_currentBlock, "");
+	m_currentBlock->exit = CFG::BasicBlock::Jump{move(_debugData), &_target, _backwards};
+	m_currentBlock = &_target;
+}
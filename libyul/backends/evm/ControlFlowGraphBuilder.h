@@ -0,0 +1,107 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Transformation of a Yul AST into a control flow graph.
+ */
+
+#pragma once
+
+#include <libyul/backends/evm/ControlFlowGraph.h>
+
+#include <memory>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct AsmAnalysisInfo;
+struct EVMDialect;
+
+/**
+ * Builds the control flow graph of a Yul block for the CFG-based EVM code transform.
+ *
+ * Afterwards, it determines which functions can return to their caller, cuts off every
+ * basic block after the first operation that does not return (terminating builtins and calls
+ * to such functions) and removes all blocks that are unreachable from the main entry or
+ * a function entry.
+ */
+class ControlFlowGraphBuilder
+{
+public:
+	ControlFlowGraphBuilder(ControlFlowGraphBuilder const&) = delete;
+	ControlFlowGraphBuilder& operator=(ControlFlowGraphBuilder const&) = delete;
+
+	/// @returns the control flow graph of @a _block, which has to be the outermost block of an object.
+	static std::unique_ptr<CFG> build(AsmAnalysisInfo const& _analysisInfo, EVMDialect const& _dialect, Block const& _block);
+
+	StackSlot operator()(Expression const& _expression);
+	StackSlot operator()(Literal const& _literal);
+	StackSlot operator()(Identifier const& _identifier);
+	StackSlot operator()(FunctionCall const& _call);
+
+	void operator()(VariableDeclaration const& _varDecl);
+	void operator()(Assignment const& _assignment);
+	void operator()(ExpressionStatement const& _statement);
+
+	void operator()(Block const& _block);
+
+	void operator()(If const& _if);
+	void operator()(Switch const& _switch);
+	void operator()(ForLoop const&);
+	void operator()(Break const&);
+	void operator()(Continue const&);
+	void operator()(Leave const&);
+	void operator()(FunctionDefinition const&);
+
+private:
+	ControlFlowGraphBuilder(CFG& _graph, AsmAnalysisInfo const& _analysisInfo, EVMDialect const& _dialect);
+
+	/// Appends the operations that evaluate @a _call to the current block.
+	/// @returns the operation of the call itself.
+	CFG::Operation const& visitFunctionCall(FunctionCall const& _call);
+	/// @returns the slots holding the values of @a _expression, which has to produce @a _expectedValues values.
+	Stack visitAssignmentRightHandSide(Expression const& _expression, size_t _expectedValues);
+
+	Scope::Function const& lookupFunction(YulString _name) const;
+	Scope::Variable const& lookupVariable(YulString _name) const;
+
+	/// Ends the current block with a conditional jump. The current block has to be set explicitly afterwards.
+	void makeConditionalJump(
+		std::shared_ptr<DebugData const> _debugData,
+		StackSlot _condition,
+		CFG::BasicBlock& _nonZero,
+		CFG::BasicBlock& _zero
+	);
+	/// Ends the current block with a jump to @a _target and continues in @a _target.
+	void jump(std::shared_ptr<DebugData const> _debugData, CFG::BasicBlock& _target, bool _backwards = false);
+
+	CFG& m_graph;
+	AsmAnalysisInfo const& m_info;
+	EVMDialect const& m_dialect;
+	CFG::BasicBlock* m_currentBlock = nullptr;
+	Scope* m_scope = nullptr;
+	struct ForLoopInfo
+	{
+		CFG::BasicBlock* afterLoop = nullptr;
+		CFG::BasicBlock* post = nullptr;
+	};
+	std::optional<ForLoopInfo> m_forLoopInfo;
+	CFG::FunctionInfo* m_currentFunction = nullptr;
+};
+
+}
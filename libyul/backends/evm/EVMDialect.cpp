@@ -27,6 +27,7 @@
 #include <libyul/Exceptions.h>
 #include <libyul/AsmParser.h>
 #include <libyul/backends/evm/AbstractAssembly.h>
+#include <libyul/Utilities.h>
 
 #include <libevmasm/SemanticInformation.h>
 #include <libevmasm/Instruction.h>
@@ -36,6 +37,7 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/tail.hpp>
 
+#include <mutex>
 #include <regex>
 
 using namespace std;
@@ -177,9 +179,15 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 				FunctionCall const& _call,
 				AbstractAssembly& _assembly,
 				BuiltinContext&,
-				function<void(Expression const&)> _visitExpression
+				function<void(Expression const&)>
 			) {
-				visitArguments(_assembly, _call, _visitExpression);
+				yulAssert(_call.arguments.size() == 1, "");
+				Literal const* literal = get_if<Literal>(&_call.arguments.front());
+				yulAssert(literal, "");
+				// Keep the location of the literal for the push, as if the argument was visited.
+				_assembly.setSourceLocation(literal->debugData->location);
+				_assembly.appendConstant(valueOfLiteral(*literal));
+				_assembly.setSourceLocation(_call.debugData->location);
 			})
 		);
 
@@ -330,7 +338,9 @@ bool EVMDialect::reservedIdentifier(YulString _name) const
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard lock(dialectsMutex); dialects.clear(); }};
+	lock_guard lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialect>(_version, false);
 	return *dialects[_version];
@@ -339,7 +349,9 @@ EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard lock(dialectsMutex); dialects.clear(); }};
+	lock_guard lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialect>(_version, true);
 	return *dialects[_version];
@@ -367,6 +379,7 @@ SideEffects EVMDialect::sideEffectsOfInstruction(evmasm::Instruction _instructio
 BuiltinFunctionForEVM const* EVMDialect::verbatimFunction(size_t _arguments, size_t _returnVariables) const
 {
 	pair<size_t, size_t> key{_arguments, _returnVariables};
+	lock_guard lock(m_verbatimFunctionsMutex);
 	shared_ptr<BuiltinFunctionForEVM const>& function = m_verbatimFunctions[key];
 	if (!function)
 	{
@@ -503,7 +516,9 @@ BuiltinFunctionForEVM const* EVMDialectTyped::equalityFunction(YulString _type)
 EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
 	static map<langutil::EVMVersion, unique_ptr<EVMDialectTyped const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] { lock_guard lock(dialectsMutex); dialects.clear(); }};
+	lock_guard lock(dialectsMutex);
 	if (!dialects[_version])
 		dialects[_version] = make_unique<EVMDialectTyped>(_version, true);
 	return *dialects[_version];
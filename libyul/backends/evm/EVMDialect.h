@@ -28,6 +28,7 @@
 #include <liblangutil/EVMVersion.h>
 
 #include <map>
+#include <mutex>
 #include <set>
 
 namespace solidity::yul
@@ -98,7 +99,9 @@ protected:
 	bool const m_objectAccess;
 	langutil::EVMVersion const m_evmVersion;
 	std::map<YulString, BuiltinFunctionForEVM> m_functions;
+	/// Verbatim functions are created on demand. The dialects are shared, so this is guarded by a mutex.
 	std::map<std::pair<size_t, size_t>, std::shared_ptr<BuiltinFunctionForEVM const>> mutable m_verbatimFunctions;
+	std::mutex mutable m_verbatimFunctionsMutex;
 	std::set<YulString> m_reserved;
 };
 
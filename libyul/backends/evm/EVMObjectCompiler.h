@@ -30,13 +30,20 @@ struct EVMDialect;
 class EVMObjectCompiler
 {
 public:
-	static void compile(Object& _object, AbstractAssembly& _assembly, EVMDialect const& _dialect, bool _optimize);
+	/// @param _optimizeStackLayout if true, uses OptimizedEVMCodeTransform instead of CodeTransform.
+	static void compile(
+		Object& _object,
+		AbstractAssembly& _assembly,
+		EVMDialect const& _dialect,
+		bool _optimize,
+		bool _optimizeStackLayout = false
+	);
 private:
 	EVMObjectCompiler(AbstractAssembly& _assembly, EVMDialect const& _dialect):
 		m_assembly(_assembly), m_dialect(_dialect)
 	{}
 
-	void run(Object& _object, bool _optimize);
+	void run(Object& _object, bool _optimize, bool _optimizeStackLayout);
 
 	AbstractAssembly& m_assembly;
 	EVMDialect const& m_dialect;
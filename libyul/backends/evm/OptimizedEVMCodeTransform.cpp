@@ -0,0 +1,369 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Code generator for translating Yul / inline assembly to EVM based on a control flow graph
+ * and precomputed stack layouts.
+ */
+
+#include <libyul/backends/evm/OptimizedEVMCodeTransform.h>
+
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/NoOutputAssembly.h>
+#include <libyul/backends/evm/StackHelpers.h>
+
+#include <libevmasm/Instruction.h>
+
+#include <libsolutil/Visitor.h>
+
+#include <range/v3/view/reverse.hpp>
+
+#include <limits>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+langutil::SourceLocation extractSourceLocationFromDebugData(shared_ptr<DebugData const> const& _debugData)
+{
+	return _debugData ? _debugData->location : langutil::SourceLocation{};
+}
+
+}
+
+bool OptimizedEVMCodeTransform::run(
+	AbstractAssembly& _assembly,
+	AsmAnalysisInfo const& _analysisInfo,
+	Block const& _block,
+	EVMDialect const& _dialect,
+	BuiltinContext& _builtinContext
+)
+{
+	unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(_analysisInfo, _dialect, _block);
+	optional<StackLayout> stackLayout = StackLayoutGenerator::run(*cfg);
+	if (!stackLayout)
+		return false;
+
+	// Unreachable slots are only detected while generating code, so do a dry run first.
+	NoOutputAssembly dryRunAssembly;
+	dryRunAssembly.setStackHeight(_assembly.stackHeight());
+	if (!generate(dryRunAssembly, _builtinContext, *cfg, *stackLayout).empty())
+		return false;
+
+	vector<StackTooDeepError> stackErrors = generate(_assembly, _builtinContext, *cfg, *stackLayout);
+	yulAssert(stackErrors.empty(), "Stack errors not detected by the dry run.");
+	return true;
+}
+
+vector<StackTooDeepError> OptimizedEVMCodeTransform::generate(
+	AbstractAssembly& _assembly,
+	BuiltinContext& _builtinContext,
+	CFG const& _cfg,
+	StackLayout const& _stackLayout
+)
+{
+	OptimizedEVMCodeTransform codeTransform(_assembly, _builtinContext, _cfg, _stackLayout);
+	codeTransform.generateCode(*_cfg.entry);
+	for (Scope::Function const* function: _cfg.functions)
+		codeTransform.generateFunction(_cfg.functionInfo.at(function));
+	return move(codeTransform.m_stackErrors);
+}
+
+OptimizedEVMCodeTransform::OptimizedEVMCodeTransform(
+	AbstractAssembly& _assembly,
+	BuiltinContext& _builtinContext,
+	CFG const& _cfg,
+	StackLayout const& _stackLayout
+):
+	m_assembly(_assembly),
+	m_builtinContext(_builtinContext),
+	m_cfg(_cfg),
+	m_stackLayout(_stackLayout)
+{
+}
+
+void OptimizedEVMCodeTransform::generateCode(CFG::BasicBlock const& _entry)
+{
+	// The zero target of a conditional jump is generated in place, the non-zero target once
+	// the code that is generated in place ends.
+	PendingBranches pendingBranches;
+	CFG::BasicBlock const* next = &_entry;
+	while (next || !pendingBranches.empty())
+		if (next)
+			next = generateBlock(*next, pendingBranches);
+		else
+		{
+			auto [label, stack, target] = move(pendingBranches.back());
+			pendingBranches.pop_back();
+			m_stack = move(stack);
+			m_assembly.setStackHeight(static_cast<int>(m_stack.size()));
+			m_assembly.appendLabel(label);
+			next = enterBlock(*target);
+		}
+}
+
+CFG::BasicBlock const* OptimizedEVMCodeTransform::generateBlock(
+	CFG::BasicBlock const& _block,
+	PendingBranches& _pendingBranches
+)
+{
+	yulAssert(m_generatedBlocks.insert(&_block).second, "");
+	m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_block.debugData));
+	if (_block.entries.size() > 1)
+	{
+		yulAssert(m_stack == m_stackLayout.blockInfos.at(&_block).entryLayout, "");
+		m_assembly.appendLabel(blockLabel(_block));
+	}
+
+	// Nothing below the slots that are used by a block that never returns has to be cleaned up.
+	bool terminates =
+		holds_alternative<CFG::BasicBlock::Terminated>(_block.exit) ||
+		holds_alternative<CFG::BasicBlock::MainExit>(_block.exit);
+	size_t junkPrefix = 0;
+	if (terminates && !_block.operations.empty())
+		junkPrefix = cheapestJunkPrefix(m_stackLayout.operationEntryLayout.at(&_block.operations.front()));
+
+	for (CFG::Operation const& operation: _block.operations)
+	{
+		Stack targetStack(junkPrefix, JunkSlot{});
+		Stack const& layout = m_stackLayout.operationEntryLayout.at(&operation);
+		targetStack.insert(targetStack.end(), layout.begin(), layout.end());
+		createStackLayout(targetStack);
+		generateOperation(operation);
+	}
+
+	Stack const& exitLayout = m_stackLayout.blockInfos.at(&_block).exitLayout;
+	return std::visit(util::GenericVisitor{
+		[&](CFG::BasicBlock::MainExit const&) -> CFG::BasicBlock const* {
+			m_assembly.appendInstruction(evmasm::Instruction::STOP);
+			return nullptr;
+		},
+		[&](CFG::BasicBlock::Terminated const&) -> CFG::BasicBlock const* {
+			return nullptr;
+		},
+		[&](CFG::BasicBlock::Jump const& _jump) -> CFG::BasicBlock const* {
+			m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_jump.debugData));
+			return enterBlock(*_jump.target);
+		},
+		[&](CFG::BasicBlock::ConditionalJump const& _jump) -> CFG::BasicBlock const* {
+			m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_jump.debugData));
+			createStackLayout(exitLayout);
+			AbstractAssembly::LabelID nonZeroLabel = m_assembly.newLabelId();
+			m_assembly.appendJumpToIf(nonZeroLabel);
+			m_stack.pop_back();
+			_pendingBranches.emplace_back(nonZeroLabel, m_stack, _jump.nonZero);
+			return enterBlock(*_jump.zero);
+		},
+		[&](CFG::BasicBlock::FunctionReturn const& _return) -> CFG::BasicBlock const* {
+			yulAssert(m_currentFunctionInfo && _return.info == m_currentFunctionInfo, "");
+			yulAssert(m_currentFunctionInfo->canContinue, "");
+			m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_return.debugData));
+			createStackLayout(exitLayout);
+			m_assembly.appendJump(0, AbstractAssembly::JumpType::OutOfFunction);
+			return nullptr;
+		}
+	}, _block.exit);
+}
+
+CFG::BasicBlock const* OptimizedEVMCodeTransform::enterBlock(CFG::BasicBlock const& _target)
+{
+	if (_target.entries.size() == 1)
+		return &_target;
+	createStackLayout(m_stackLayout.blockInfos.at(&_target).entryLayout);
+	if (!m_generatedBlocks.count(&_target))
+		return &_target;
+	m_assembly.appendJumpTo(blockLabel(_target));
+	return nullptr;
+}
+
+void OptimizedEVMCodeTransform::generateOperation(CFG::Operation const& _operation)
+{
+	yulAssert(m_stack.size() >= _operation.input.size(), "");
+	size_t baseHeight = m_stack.size() - _operation.input.size();
+	for (size_t i = 0; i < _operation.input.size(); ++i)
+		yulAssert(m_stack[baseHeight + i] == _operation.input[i], "");
+
+	std::visit(util::GenericVisitor{
+		[&](CFG::FunctionCall const& _call) {
+			m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_call.debugData));
+			m_assembly.appendJumpTo(
+				functionLabel(*_call.function),
+				static_cast<int>(_operation.output.size()) - static_cast<int>(_operation.input.size()),
+				AbstractAssembly::JumpType::IntoFunction
+			);
+			if (_call.canContinue)
+				m_assembly.appendLabel(returnLabel(*_call.functionCall));
+		},
+		[&](CFG::BuiltinCall const& _call) {
+			m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_call.debugData));
+			// The arguments are already on the stack.
+			_call.builtin->generateCode(*_call.functionCall, m_assembly, m_builtinContext, [](Expression const&) {});
+		},
+		[&](CFG::Assignment const& _assignment) {
+			// Other copies of the assigned variables now hold outdated values.
+			for (size_t i = 0; i < baseHeight; ++i)
+				for (VariableSlot const& variable: _assignment.variables)
+					if (m_stack[i] == StackSlot{variable})
+						m_stack[i] = JunkSlot{};
+		}
+	}, _operation.operation);
+
+	m_stack.resize(baseHeight);
+	m_stack.insert(m_stack.end(), _operation.output.begin(), _operation.output.end());
+	yulAssert(m_assembly.stackHeight() == static_cast<int>(m_stack.size()), "Invalid stack height after operation.");
+}
+
+void OptimizedEVMCodeTransform::generateFunction(CFG::FunctionInfo const& _functionInfo)
+{
+	m_currentFunctionInfo = &_functionInfo;
+	m_stack.clear();
+	if (_functionInfo.canContinue)
+		m_stack.emplace_back(FunctionReturnLabelSlot{_functionInfo.function});
+	for (VariableSlot const& parameter: _functionInfo.parameters | ranges::views::reverse)
+		m_stack.emplace_back(parameter);
+
+	m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_functionInfo.debugData));
+	m_assembly.setStackHeight(static_cast<int>(m_stack.size()));
+	m_assembly.appendLabel(functionLabel(*_functionInfo.function));
+	generateCode(*_functionInfo.entry);
+	m_currentFunctionInfo = nullptr;
+}
+
+void OptimizedEVMCodeTransform::createStackLayout(Stack const& _targetStack)
+{
+	yul::createStackLayout(
+		m_stack,
+		_targetStack,
+		[&](unsigned _depth) {
+			if (_depth > 16)
+			{
+				stackError(m_stack.at(m_stack.size() - _depth - 1), _depth + 1);
+				return;
+			}
+			m_assembly.appendInstruction(evmasm::swapInstruction(_depth));
+		},
+		[&](StackSlot const& _slot) {
+			if (optional<size_t> depth = depthOf(m_stack, _slot))
+			{
+				if (*depth <= 16)
+				{
+					m_assembly.appendInstruction(evmasm::dupInstruction(static_cast<unsigned>(*depth)));
+					return;
+				}
+				if (!canBeFreelyGenerated(_slot))
+				{
+					stackError(_slot, *depth);
+					m_assembly.appendConstant(0);
+					return;
+				}
+			}
+			std::visit(util::GenericVisitor{
+				[&](LiteralSlot const& _literal) {
+					m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_literal.debugData));
+					m_assembly.appendConstant(_literal.value);
+				},
+				[&](FunctionCallReturnLabelSlot const& _returnLabel) {
+					m_assembly.appendLabelReference(returnLabel(*_returnLabel.call));
+				},
+				[&](VariableSlot const& _variable) {
+					// Return variables are zero until they are assigned to for the first time.
+					yulAssert(
+						m_currentFunctionInfo &&
+						find(
+							m_currentFunctionInfo->returnVariables.begin(),
+							m_currentFunctionInfo->returnVariables.end(),
+							_variable
+						) != m_currentFunctionInfo->returnVariables.end(),
+						"Variable " + _variable.variable->name.str() + " is not on the stack."
+					);
+					m_assembly.setSourceLocation(extractSourceLocationFromDebugData(_variable.debugData));
+					m_assembly.appendConstant(0);
+				},
+				[&](JunkSlot const&) {
+					if (m_stack.empty())
+						m_assembly.appendConstant(0);
+					else
+						m_assembly.appendInstruction(evmasm::Instruction::DUP1);
+				},
+				[&](auto const&) {
+					yulAssert(false, "Slot " + stackSlotToString(_slot) + " is not on the stack.");
+				}
+			}, _slot);
+		},
+		[&]() { m_assembly.appendInstruction(evmasm::Instruction::POP); }
+	);
+	yulAssert(m_assembly.stackHeight() == static_cast<int>(m_stack.size()), "");
+}
+
+size_t OptimizedEVMCodeTransform::cheapestJunkPrefix(Stack const& _layout) const
+{
+	size_t bestPrefix = 0;
+	size_t bestCost = numeric_limits<size_t>::max();
+	// Prefer more junk in case of ties, since that reduces the effort of cleaning up the stack.
+	for (size_t prefix = m_stack.size() + 1; prefix > 0; --prefix)
+	{
+		Stack target(prefix - 1, JunkSlot{});
+		target.insert(target.end(), _layout.begin(), _layout.end());
+		size_t cost = evaluateStackTransformationCost(m_stack, target);
+		if (cost < bestCost)
+		{
+			bestCost = cost;
+			bestPrefix = prefix - 1;
+		}
+	}
+	return bestPrefix;
+}
+
+void OptimizedEVMCodeTransform::stackError(StackSlot const& _slot, size_t _depth)
+{
+	YulString variableName;
+	if (auto const* variable = get_if<VariableSlot>(&_slot))
+		variableName = variable->variable->name;
+	YulString functionName = m_currentFunctionInfo ? m_currentFunctionInfo->name : YulString{};
+	string message =
+		"Cannot access " + stackSlotToString(_slot) + ": it is " + to_string(_depth - 16) +
+		" slot(s) too deep inside the stack.";
+	if (!functionName.empty())
+		message += " (in function " + functionName.str() + ")";
+	m_stackErrors.emplace_back(functionName, variableName, static_cast<int>(_depth - 16), message);
+	m_assembly.markAsInvalid();
+}
+
+AbstractAssembly::LabelID OptimizedEVMCodeTransform::functionLabel(Scope::Function const& _function)
+{
+	if (!m_functionLabels.count(&_function))
+		m_functionLabels[&_function] = m_assembly.newLabelId();
+	return m_functionLabels.at(&_function);
+}
+
+AbstractAssembly::LabelID OptimizedEVMCodeTransform::returnLabel(FunctionCall const& _call)
+{
+	if (!m_returnLabels.count(&_call))
+		m_returnLabels[&_call] = m_assembly.newLabelId();
+	return m_returnLabels.at(&_call);
+}
+
+AbstractAssembly::LabelID OptimizedEVMCodeTransform::blockLabel(CFG::BasicBlock const& _block)
+{
+	if (!m_blockLabels.count(&_block))
+		m_blockLabels[&_block] = m_assembly.newLabelId();
+	return m_blockLabels.at(&_block);
+}
@@ -0,0 +1,127 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Code generator for translating Yul / inline assembly to EVM based on a control flow graph
+ * and precomputed stack layouts.
+ */
+
+#pragma once
+
+#include <libyul/backends/evm/AbstractAssembly.h>
+#include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+#include <libyul/Exceptions.h>
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct AsmAnalysisInfo;
+struct BuiltinContext;
+struct EVMDialect;
+
+/**
+ * Alternative to CodeTransform that first builds the control flow graph of the code and
+ * determines the stack layout of every block and operation (see StackLayoutGenerator).
+ * Code is generated by shuffling the stack into the desired layout before each operation
+ * and at the end of each block.
+ *
+ * Blocks with a single entry are generated directly after their predecessor. Blocks that end
+ * in a terminating instruction do not clean up the part of the stack they do not use.
+ * Calls to functions that never return do not push a return label.
+ */
+class OptimizedEVMCodeTransform
+{
+public:
+	/// Generates code for @a _block, which has to be the outermost block of an object, and appends
+	/// it to @a _assembly.
+	/// @returns false without appending anything if no stack layout could be determined or if
+	/// some slots could not be reached, so that the caller can use CodeTransform instead.
+	[[nodiscard]] static bool run(
+		AbstractAssembly& _assembly,
+		AsmAnalysisInfo const& _analysisInfo,
+		Block const& _block,
+		EVMDialect const& _dialect,
+		BuiltinContext& _builtinContext
+	);
+
+	OptimizedEVMCodeTransform(OptimizedEVMCodeTransform const&) = delete;
+	OptimizedEVMCodeTransform& operator=(OptimizedEVMCodeTransform const&) = delete;
+
+private:
+	using PendingBranches = std::vector<std::tuple<AbstractAssembly::LabelID, Stack, CFG::BasicBlock const*>>;
+
+	OptimizedEVMCodeTransform(
+		AbstractAssembly& _assembly,
+		BuiltinContext& _builtinContext,
+		CFG const& _cfg,
+		StackLayout const& _stackLayout
+	);
+
+	/// Generates code for @a _cfg using @a _stackLayout and appends it to @a _assembly.
+	/// @returns the errors for slots that could not be reached.
+	static std::vector<StackTooDeepError> generate(
+		AbstractAssembly& _assembly,
+		BuiltinContext& _builtinContext,
+		CFG const& _cfg,
+		StackLayout const& _stackLayout
+	);
+
+	/// Generates the code reachable from @a _entry, starting with the current stack.
+	void generateCode(CFG::BasicBlock const& _entry);
+	/// Generates the code of @a _block, registering the non-zero targets of conditional jumps in
+	/// @a _pendingBranches. @returns the block to be generated next in place, if any.
+	CFG::BasicBlock const* generateBlock(CFG::BasicBlock const& _block, PendingBranches& _pendingBranches);
+	/// Transfers control to @a _target, which is either generated next in place, in which case it
+	/// is returned, or jumped to.
+	CFG::BasicBlock const* enterBlock(CFG::BasicBlock const& _target);
+	void generateOperation(CFG::Operation const& _operation);
+	void generateFunction(CFG::FunctionInfo const& _functionInfo);
+
+	/// Shuffles the current stack into @a _targetStack.
+	void createStackLayout(Stack const& _targetStack);
+	/// @returns the number of junk slots below @a _layout that result in the cheapest transformation
+	/// of the current stack into it.
+	size_t cheapestJunkPrefix(Stack const& _layout) const;
+
+	/// Records a stack error for @a _slot, which is @a _depth slots deep, and marks the assembly as invalid.
+	void stackError(StackSlot const& _slot, size_t _depth);
+
+	AbstractAssembly::LabelID functionLabel(Scope::Function const& _function);
+	AbstractAssembly::LabelID returnLabel(FunctionCall const& _call);
+	AbstractAssembly::LabelID blockLabel(CFG::BasicBlock const& _block);
+
+	AbstractAssembly& m_assembly;
+	BuiltinContext& m_builtinContext;
+	CFG const& m_cfg;
+	StackLayout const& m_stackLayout;
+	/// Current stack of the function (or main code) that is being generated.
+	Stack m_stack;
+	CFG::FunctionInfo const* m_currentFunctionInfo = nullptr;
+	std::map<Scope::Function const*, AbstractAssembly::LabelID> m_functionLabels;
+	std::map<FunctionCall const*, AbstractAssembly::LabelID> m_returnLabels;
+	std::map<CFG::BasicBlock const*, AbstractAssembly::LabelID> m_blockLabels;
+	std::set<CFG::BasicBlock const*> m_generatedBlocks;
+	std::vector<StackTooDeepError> m_stackErrors;
+};
+
+}
@@ -0,0 +1,206 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Utilities for transforming one stack layout into another.
+ */
+
+#pragma once
+
+#include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/Visitor.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::yul
+{
+
+inline std::string stackSlotToString(StackSlot const& _slot)
+{
+	return std::visit(util::GenericVisitor{
+		[](FunctionCallReturnLabelSlot const& _ret) -> std::string { return "RET[" + _ret.call->functionName.name.str() + "]"; },
+		[](FunctionReturnLabelSlot const&) -> std::string { return "RET"; },
+		[](VariableSlot const& _var) { return _var.variable->name.str(); },
+		[](LiteralSlot const& _lit) { return util::formatNumber(_lit.value); },
+		[](TemporarySlot const& _tmp) -> std::string { return "TMP[" + _tmp.call->functionName.name.str() + ", " + std::to_string(_tmp.index) + "]"; },
+		[](JunkSlot const&) -> std::string { return "JUNK"; }
+	}, _slot);
+}
+
+inline std::string stackToString(Stack const& _stack)
+{
+	std::string result("[ ");
+	for (auto const& slot: _stack)
+		result += stackSlotToString(slot) + ' ';
+	result += ']';
+	return result;
+}
+
+/// @returns the distance of the topmost occurrence of @a _slot from the top of @a _stack,
+/// i.e. 1 for the top slot, or nullopt if @a _slot does not occur.
+inline std::optional<size_t> depthOf(Stack const& _stack, StackSlot const& _slot)
+{
+	auto it = std::find(_stack.rbegin(), _stack.rend(), _slot);
+	if (it == _stack.rend())
+		return std::nullopt;
+	return static_cast<size_t>(std::distance(_stack.rbegin(), it)) + 1;
+}
+
+/// Transforms @a _currentStack into @a _targetStack by invoking the given shuffling operations.
+/// A JunkSlot in @a _targetStack can be occupied by any slot.
+/// @a _swap is called with the depth @a n of the slot that is exchanged with the top slot
+/// (corresponding to SWAPn), @a _pushOrDup with a slot to be placed on top of the stack and
+/// @a _pop to remove the top slot. All of them are called before @a _currentStack is modified,
+/// which has the target layout on return.
+///
+/// Every slot of the current stack is first assigned its final position or marked to be
+/// popped, where slots that already are in place are kept and other copies are moved before
+/// new ones are created. The top slot is then repeatedly moved to its final position, popped,
+/// or replaced by a slot that still has to be moved or created.
+template <typename Swap, typename PushOrDup, typename Pop>
+void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _swap, PushOrDup _pushOrDup, Pop _pop)
+{
+	size_t const targetSize = _targetStack.size();
+	auto isJunk = [](StackSlot const& _slot) { return std::holds_alternative<JunkSlot>(_slot); };
+
+	// Final position of each slot of the current stack or nullopt if it is to be popped.
+	std::vector<std::optional<size_t>> destination(_currentStack.size());
+	// Whether there is a slot of the current stack with the respective final position.
+	std::vector<bool> hasSource(targetSize, false);
+	for (size_t position = 0; position < std::min(_currentStack.size(), targetSize); ++position)
+		if (isJunk(_targetStack[position]) || _currentStack[position] == _targetStack[position])
+		{
+			destination[position] = position;
+			hasSource[position] = true;
+		}
+	for (size_t target = 0; target < targetSize; ++target)
+		if (!hasSource[target] && !isJunk(_targetStack[target]))
+			for (size_t position = _currentStack.size(); position > 0; --position)
+				if (!destination[position - 1] && _currentStack[position - 1] == _targetStack[target])
+				{
+					destination[position - 1] = target;
+					hasSource[target] = true;
+					break;
+				}
+
+	auto pushNew = [&](size_t _target) {
+		yulAssert(!hasSource[_target], "");
+		_pushOrDup(_targetStack[_target]);
+		_currentStack.emplace_back(_targetStack[_target]);
+		destination.emplace_back(_target);
+		hasSource[_target] = true;
+	};
+	auto swapWithTop = [&](size_t _position) {
+		size_t top = _currentStack.size() - 1;
+		yulAssert(_position < top, "");
+		_swap(static_cast<unsigned>(top - _position));
+		std::swap(_currentStack[_position], _currentStack[top]);
+		std::swap(destination[_position], destination[top]);
+	};
+
+	size_t const maxIterations = 16 + 8 * (_currentStack.size() + targetSize) * (_currentStack.size() + targetSize);
+	for (size_t iteration = 0; ; ++iteration)
+	{
+		yulAssert(iteration < maxIterations, "Stack shuffling did not terminate.");
+		if (_currentStack.empty())
+		{
+			if (targetSize == 0)
+				break;
+			pushNew(0);
+			continue;
+		}
+
+		size_t const top = _currentStack.size() - 1;
+		if (!destination[top])
+		{
+			_pop();
+			_currentStack.pop_back();
+			destination.pop_back();
+			continue;
+		}
+		if (*destination[top] < top)
+		{
+			swapWithTop(*destination[top]);
+			continue;
+		}
+		if (*destination[top] > top)
+		{
+			// The top slot belongs higher up, so its position has to be filled first.
+			auto source = std::find(destination.begin(), destination.begin() + static_cast<ptrdiff_t>(top), top);
+			if (source != destination.begin() + static_cast<ptrdiff_t>(top))
+				swapWithTop(static_cast<size_t>(source - destination.begin()));
+			else
+				pushNew(top);
+			continue;
+		}
+
+		// The top slot is in place. Fix the lowest misplaced slot that can be fixed without
+		// growing the stack. If its position is not the final position of any slot, it is
+		// replaced by a new slot, otherwise it is exchanged with the top slot.
+		bool fixed = false;
+		for (size_t position = 0; position < top && !fixed; ++position)
+			if (destination[position] != position)
+			{
+				if (position < targetSize && !hasSource[position])
+					pushNew(position);
+				else if (!destination[position] || *destination[position] < top)
+					swapWithTop(position);
+				else
+					continue;
+				fixed = true;
+			}
+		if (fixed)
+			continue;
+
+		if (_currentStack.size() == targetSize)
+			break;
+		yulAssert(_currentStack.size() < targetSize, "");
+		pushNew(_currentStack.size());
+	}
+	yulAssert(_currentStack.size() == targetSize, "");
+}
+
+/// @returns the number of operations needed to transform @a _source into @a _target,
+/// where each operation that reaches deeper than 16 slots or requires a slot that is not
+/// available counts as a thousand.
+inline size_t evaluateStackTransformationCost(Stack _source, Stack const& _target)
+{
+	size_t constexpr unreachablePenalty = 1000;
+	size_t cost = 0;
+	createStackLayout(
+		_source,
+		_target,
+		[&](unsigned _depth) { cost += _depth > 16 ? unreachablePenalty : 1; },
+		[&](StackSlot const& _slot) {
+			if (canBeFreelyGenerated(_slot))
+				++cost;
+			else if (std::optional<size_t> depth = depthOf(_source, _slot); depth && *depth <= 16)
+				++cost;
+			else
+				cost += unreachablePenalty;
+		},
+		[&]() { ++cost; }
+	);
+	return cost;
+}
+
+}
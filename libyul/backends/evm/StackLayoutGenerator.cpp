@@ -0,0 +1,270 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Stack layout generator for the CFG-based EVM code transform.
+ */
+
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <libyul/backends/evm/StackHelpers.h>
+
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/Visitor.h>
+
+#include <range/v3/view/reverse.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace std;
+
+namespace
+{
+
+bool contains(Stack const& _stack, StackSlot const& _slot)
+{
+	return find(_stack.begin(), _stack.end(), _slot) != _stack.end();
+}
+
+/// @returns true if all slots of @a _required that cannot be freely generated occur in @a _available.
+bool providesAll(Stack const& _available, Stack const& _required)
+{
+	return all_of(_required.begin(), _required.end(), [&](StackSlot const& _slot) {
+		return canBeFreelyGenerated(_slot) || contains(_available, _slot);
+	});
+}
+
+/// @returns the blocks reachable from @a _entry without following backwards jumps, ordered
+/// such that each block occurs after all of its successors.
+vector<CFG::BasicBlock const*> reversedTopologicalOrder(CFG::BasicBlock const& _entry)
+{
+	vector<CFG::BasicBlock const*> order;
+	set<CFG::BasicBlock const*> visited{&_entry};
+	// Blocks with the index of the next successor to visit.
+	vector<pair<CFG::BasicBlock const*, size_t>> toVisit{{&_entry, 0}};
+	while (!toVisit.empty())
+	{
+		auto& [block, nextSuccessor] = toVisit.back();
+		vector<CFG::BasicBlock const*> successors = std::visit(util::GenericVisitor{
+			[](CFG::BasicBlock::Jump const& _jump) {
+				return _jump.backwards ? vector<CFG::BasicBlock const*>{} : vector<CFG::BasicBlock const*>{_jump.target};
+			},
+			[](CFG::BasicBlock::ConditionalJump const& _jump) {
+				return vector<CFG::BasicBlock const*>{_jump.zero, _jump.nonZero};
+			},
+			[](auto const&) { return vector<CFG::BasicBlock const*>{}; }
+		}, block->exit);
+		if (nextSuccessor < successors.size())
+		{
+			CFG::BasicBlock const* successor = successors[nextSuccessor++];
+			if (visited.insert(successor).second)
+				toVisit.emplace_back(successor, 0);
+		}
+		else
+		{
+			order.emplace_back(block);
+			toVisit.pop_back();
+		}
+	}
+	return order;
+}
+
+}
+
+optional<StackLayout> StackLayoutGenerator::run(CFG const& _cfg)
+{
+	StackLayout layout;
+	StackLayoutGenerator generator{layout};
+	if (!generator.processEntryPoint(*_cfg.entry))
+		return nullopt;
+	for (Scope::Function const* function: _cfg.functions)
+		if (!generator.processEntryPoint(*_cfg.functionInfo.at(function).entry))
+			return nullopt;
+	return layout;
+}
+
+bool StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry)
+{
+	vector<CFG::BasicBlock const*> order = reversedTopologicalOrder(_entry);
+	vector<CFG::BasicBlock const*> loopEnds;
+	for (CFG::BasicBlock const* block: order)
+		if (auto const* jump = get_if<CFG::BasicBlock::Jump>(&block->exit); jump && jump->backwards)
+			loopEnds.emplace_back(block);
+
+	// The exit layout of a block that ends a loop is the entry layout of the loop head from the
+	// previous iteration. The set of slots in each layout can only grow from one iteration to the
+	// next, so requiring that each loop end provides all slots needed at the loop head terminates.
+	// Afterwards, a few more iterations are spent on making the layouts match exactly.
+	// Since combineStack only chooses the cheapest of several layouts, this is not guaranteed
+	// for loops that contain conditional jumps, so the number of iterations is limited.
+	size_t constexpr maxIterationsForExactMatch = 4;
+	size_t constexpr maxIterations = 1000;
+	for (size_t iterations = 0, exactMatchIterations = 0; ; )
+	{
+		if (++iterations > maxIterations)
+			return false;
+		for (CFG::BasicBlock const* block: order)
+		{
+			StackLayout::BlockInfo& info = m_layout.blockInfos[block];
+			info.exitLayout = exitLayout(*block);
+			info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block);
+		}
+
+		bool providesAllSlots = true;
+		bool exactMatch = true;
+		for (CFG::BasicBlock const* block: loopEnds)
+		{
+			Stack const& loopHeadEntry = m_layout.blockInfos.at(get<CFG::BasicBlock::Jump>(block->exit).target).entryLayout;
+			Stack const& loopEndExit = m_layout.blockInfos.at(block).exitLayout;
+			providesAllSlots = providesAllSlots && providesAll(loopEndExit, loopHeadEntry);
+			exactMatch = exactMatch && loopEndExit == loopHeadEntry;
+		}
+		if (exactMatch || (providesAllSlots && ++exactMatchIterations > maxIterationsForExactMatch))
+			return true;
+	}
+}
+
+Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG::Operation const& _operation)
+{
+	// Everything below the first output of the operation can stay where it is. The remaining
+	// slots that are still needed afterwards are kept below the input.
+	auto isOutput = [&](StackSlot const& _slot) { return contains(_operation.output, _slot); };
+	auto firstOutput = find_if(_exitStack.begin(), _exitStack.end(), isOutput);
+	Stack stack(_exitStack.begin(), firstOutput);
+	for (auto it = firstOutput; it != _exitStack.end(); ++it)
+		if (!isOutput(*it) && !canBeFreelyGenerated(*it) && !contains(stack, *it))
+			stack.emplace_back(*it);
+	stack.insert(stack.end(), _operation.input.begin(), _operation.input.end());
+	m_layout.operationEntryLayout[&_operation] = stack;
+
+	// Slots on top that can be pushed or duplicated are only created right before the operation.
+	while (!stack.empty())
+	{
+		StackSlot const& top = stack.back();
+		bool canBeDuplicated = false;
+		for (size_t depth = 2; depth <= min<size_t>(stack.size(), 17) && !canBeDuplicated; ++depth)
+			canBeDuplicated = stack[stack.size() - depth] == top;
+		if (!canBeFreelyGenerated(top) && !canBeDuplicated)
+			break;
+		stack.pop_back();
+	}
+	return stack;
+}
+
+Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::BasicBlock const& _block)
+{
+	Stack stack = move(_exitStack);
+	for (CFG::Operation const& operation: _block.operations | ranges::views::reverse)
+		stack = propagateStackThroughOperation(move(stack), operation);
+	return stack;
+}
+
+Stack StackLayoutGenerator::exitLayout(CFG::BasicBlock const& _block) const
+{
+	auto entryLayoutOf = [&](CFG::BasicBlock const* _target) -> Stack {
+		// Loop heads do not have a layout yet during the first iteration.
+		auto it = m_layout.blockInfos.find(_target);
+		return it == m_layout.blockInfos.end() ? Stack{} : it->second.entryLayout;
+	};
+	return std::visit(util::GenericVisitor{
+		[](CFG::BasicBlock::MainExit const&) { return Stack{}; },
+		[](CFG::BasicBlock::Terminated const&) { return Stack{}; },
+		[&](CFG::BasicBlock::Jump const& _jump) { return entryLayoutOf(_jump.target); },
+		[&](CFG::BasicBlock::ConditionalJump const& _jump) {
+			Stack stack = combineStack(entryLayoutOf(_jump.zero), entryLayoutOf(_jump.nonZero));
+			stack.emplace_back(_jump.condition);
+			return stack;
+		},
+		[](CFG::BasicBlock::FunctionReturn const& _return) {
+			Stack stack(_return.info->returnVariables.begin(), _return.info->returnVariables.end());
+			stack.emplace_back(FunctionReturnLabelSlot{_return.info->function});
+			return stack;
+		}
+	}, _block.exit);
+}
+
+Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _stack2)
+{
+	if (_stack1 == _stack2)
+		return _stack1;
+
+	Stack commonPrefix;
+	for (size_t i = 0; i < min(_stack1.size(), _stack2.size()) && _stack1[i] == _stack2[i]; ++i)
+		commonPrefix.emplace_back(_stack1[i]);
+
+	Stack tail;
+	for (Stack const* stack: {&_stack1, &_stack2})
+		for (size_t i = commonPrefix.size(); i < stack->size(); ++i)
+		{
+			StackSlot const& slot = (*stack)[i];
+			if (!canBeFreelyGenerated(slot) && !contains(commonPrefix, slot) && !contains(tail, slot))
+				tail.emplace_back(slot);
+		}
+
+	auto cost = [&](vector<size_t> const& _order) {
+		Stack candidate = commonPrefix;
+		for (size_t index: _order)
+			candidate.emplace_back(tail[index]);
+		return
+			evaluateStackTransformationCost(candidate, _stack1) +
+			evaluateStackTransformationCost(candidate, _stack2);
+	};
+
+	vector<size_t> order(tail.size());
+	iota(order.begin(), order.end(), 0);
+	vector<size_t> bestOrder = order;
+	size_t bestCost = cost(order);
+	// Try all orders of small tails and improve larger ones by exchanging neighbours.
+	size_t constexpr maxTailForExhaustiveSearch = 5;
+	if (tail.size() <= maxTailForExhaustiveSearch)
+		while (next_permutation(order.begin(), order.end()))
+		{
+			size_t orderCost = cost(order);
+			if (orderCost < bestCost)
+			{
+				bestCost = orderCost;
+				bestOrder = order;
+			}
+		}
+	else
+		for (bool improved = true; improved; )
+		{
+			improved = false;
+			for (size_t i = 0; i + 1 < bestOrder.size(); ++i)
+			{
+				order = bestOrder;
+				swap(order[i], order[i + 1]);
+				size_t orderCost = cost(order);
+				if (orderCost < bestCost)
+				{
+					bestCost = orderCost;
+					bestOrder = order;
+					improved = true;
+				}
+			}
+		}
+
+	Stack result = move(commonPrefix);
+	for (size_t index: bestOrder)
+		result.emplace_back(tail[index]);
+	return result;
+}
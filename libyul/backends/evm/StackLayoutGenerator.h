@@ -0,0 +1,89 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Stack layout generator for the CFG-based EVM code transform.
+ */
+
+#pragma once
+
+#include <libyul/backends/evm/ControlFlowGraph.h>
+
+#include <map>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct StackLayout
+{
+	struct BlockInfo
+	{
+		/// Layout on entry to the block. Blocks with a single entry are generated directly after
+		/// their predecessor, so for them it only serves as the desired layout for the predecessor.
+		Stack entryLayout;
+		/// Layout before the exit of the block, including the condition on top for conditional jumps.
+		Stack exitLayout;
+	};
+	std::map<CFG::BasicBlock const*, BlockInfo> blockInfos;
+	/// Layout that is required directly before each operation, with its input on top.
+	std::map<CFG::Operation const*, Stack> operationEntryLayout;
+};
+
+/**
+ * Determines the stack layouts for all blocks and operations of a control flow graph.
+ *
+ * Layouts are propagated backwards from the exits of the graph. The layout before an operation
+ * keeps all slots that are still needed afterwards in the order in which they are needed, with
+ * the input of the operation on top. Slots that can be recreated with a single push or dup are
+ * left out as long as they are at the top of the stack, so that they are only created directly
+ * before they are consumed.
+ *
+ * Loops are handled by repeating the propagation until the layout at each loop head only
+ * requires slots that are available at the end of the loop body. At conditional jumps, the
+ * layouts desired by both targets are combined into the one that is cheapest to transform into
+ * either of them.
+ */
+class StackLayoutGenerator
+{
+public:
+	/// @returns the layouts for @a _cfg or nullopt if the layouts of some loop did not stabilise.
+	static std::optional<StackLayout> run(CFG const& _cfg);
+
+private:
+	explicit StackLayoutGenerator(StackLayout& _layout): m_layout(_layout) {}
+
+	/// Determines the layouts of all blocks reachable from @a _entry.
+	/// @returns false if the layouts of some loop did not stabilise.
+	bool processEntryPoint(CFG::BasicBlock const& _entry);
+
+	/// @returns the layout required before @a _operation such that @a _exitStack can be
+	/// created afterwards, and records the layout including the input of @a _operation.
+	Stack propagateStackThroughOperation(Stack _exitStack, CFG::Operation const& _operation);
+	/// @returns the layout required on entry to @a _block given its exit layout @a _exitStack.
+	Stack propagateStackThroughBlock(Stack _exitStack, CFG::BasicBlock const& _block);
+	/// @returns the exit layout of @a _block based on the current entry layouts of its successors.
+	Stack exitLayout(CFG::BasicBlock const& _block) const;
+
+	/// @returns a layout that contains all slots of @a _stack1 and @a _stack2 that cannot be
+	/// freely generated and that can be cheaply transformed into both of them.
+	static Stack combineStack(Stack const& _stack1, Stack const& _stack2);
+
+	StackLayout& m_layout;
+};
+
+}
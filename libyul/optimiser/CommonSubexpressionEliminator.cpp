@@ -23,6 +23,7 @@
 
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/SideEffects.h>
 #include <libyul/Exceptions.h>
@@ -37,16 +38,19 @@ using namespace solidity::util;
 
 void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	CommonSubexpressionEliminator cse{
-		_context.dialect,
+	auto functionSideEffects = make_shared<map<YulString, SideEffects> const>(
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
-	};
-	cse(_ast);
+	);
+	bool concurrent = transformTopLevelStatementsConcurrently(_context, _ast, [&](Statement& _statement) {
+		CommonSubexpressionEliminator{_context.dialect, functionSideEffects}.visit(_statement);
+	});
+	if (!concurrent)
+		CommonSubexpressionEliminator{_context.dialect, functionSideEffects}(_ast);
 }
 
 CommonSubexpressionEliminator::CommonSubexpressionEliminator(
 	Dialect const& _dialect,
-	map<YulString, SideEffects> _functionSideEffects
+	shared_ptr<map<YulString, SideEffects> const> _functionSideEffects
 ):
 	DataFlowAnalyzer(_dialect, std::move(_functionSideEffects))
 {
@@ -51,7 +51,7 @@ public:
 private:
 	CommonSubexpressionEliminator(
 		Dialect const& _dialect,
-		std::map<YulString, SideEffects> _functionSideEffects
+		std::shared_ptr<std::map<YulString, SideEffects> const> _functionSideEffects
 	);
 
 protected:
@@ -43,7 +43,7 @@ using namespace solidity::yul;
 
 DataFlowAnalyzer::DataFlowAnalyzer(
 	Dialect const& _dialect,
-	map<YulString, SideEffects> _functionSideEffects
+	shared_ptr<map<YulString, SideEffects> const> _functionSideEffects
 ):
 m_dialect(_dialect),
 m_functionSideEffects(std::move(_functionSideEffects)),
@@ -227,7 +227,7 @@ void DataFlowAnalyzer::handleAssignment(set<YulString> const& _variables, Expres
 	if (!_isDeclaration)
 		clearValues(_variables);
 
-	MovableChecker movableChecker{m_dialect, &m_functionSideEffects};
+	MovableChecker movableChecker{m_dialect, m_functionSideEffects.get()};
 	if (_value)
 		movableChecker.visit(*_value);
 	else
@@ -336,7 +336,7 @@ void DataFlowAnalyzer::assignValue(YulString _variable, Expression const* _value
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
-	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
+	SideEffectsCollector sideEffects(m_dialect, _block, m_functionSideEffects.get());
 	if (sideEffects.invalidatesStorage())
 		m_storage.clear();
 	if (sideEffects.invalidatesMemory())
@@ -345,7 +345,7 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 {
-	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
+	SideEffectsCollector sideEffects(m_dialect, _expr, m_functionSideEffects.get());
 	if (sideEffects.invalidatesStorage())
 		m_storage.clear();
 	if (sideEffects.invalidatesMemory())
@@ -32,6 +32,7 @@
 #include <libsolutil/Common.h>
 
 #include <map>
+#include <memory>
 #include <set>
 
 namespace solidity::yul
@@ -83,9 +84,10 @@ public:
 	///            Side-effects of user-defined functions. Worst-case side-effects are assumed
 	///            if this is not provided or the function is not found.
 	///            The parameter is mostly used to determine movability of expressions.
+	///            It is shared, so that analyzers running concurrently do not need to copy it.
 	explicit DataFlowAnalyzer(
 		Dialect const& _dialect,
-		std::map<YulString, SideEffects> _functionSideEffects = {}
+		std::shared_ptr<std::map<YulString, SideEffects> const> _functionSideEffects = nullptr
 	);
 
 	using ASTModifier::operator();
@@ -162,7 +164,7 @@ protected:
 	Dialect const& m_dialect;
 	/// Side-effects of user-defined functions. Worst-case side-effects are assumed
 	/// if this is not provided or the function is not found.
-	std::map<YulString, SideEffects> m_functionSideEffects;
+	std::shared_ptr<std::map<YulString, SideEffects> const> m_functionSideEffects;
 
 	/// Current values of variables, always movable.
 	std::map<YulString, AssignedValue> m_value;
@@ -23,6 +23,7 @@
 
 #include <libyul/optimiser/SimplificationRules.h>
 #include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/AST.h>
 
 using namespace std;
@@ -31,7 +32,11 @@ using namespace solidity::yul;
 
 void ExpressionSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
-	ExpressionSimplifier{_context.dialect}(_ast);
+	bool concurrent = transformTopLevelStatementsConcurrently(_context, _ast, [&](Statement& _statement) {
+		ExpressionSimplifier{_context.dialect}.visit(_statement);
+	});
+	if (!concurrent)
+		ExpressionSimplifier{_context.dialect}(_ast);
 }
 
 void ExpressionSimplifier::visit(Expression& _expression)
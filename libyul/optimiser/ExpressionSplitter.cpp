@@ -78,16 +78,28 @@ void ExpressionSplitter::operator()(Block& _block)
 	vector<Statement> saved;
 	swap(saved, m_statementsToPrefix);
 
-	function<std::optional<vector<Statement>>(Statement&)> f =
-			[&](Statement& _statement) -> std::optional<vector<Statement>> {
+	// The new statements are collected directly instead of returning a separate vector
+	// for every modified statement, so that the buffer of m_statementsToPrefix is reused.
+	vector<Statement> statements;
+	bool modified = false;
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		visit(_block.statements[i]);
+		if (!modified && !m_statementsToPrefix.empty())
+		{
+			statements.reserve(_block.statements.size() + m_statementsToPrefix.size());
+			std::move(_block.statements.begin(), _block.statements.begin() + ptrdiff_t(i), back_inserter(statements));
+			modified = true;
+		}
+		if (modified)
+		{
+			std::move(m_statementsToPrefix.begin(), m_statementsToPrefix.end(), back_inserter(statements));
+			statements.emplace_back(std::move(_block.statements[i]));
+		}
 		m_statementsToPrefix.clear();
-		visit(_statement);
-		if (m_statementsToPrefix.empty())
-			return {};
-		m_statementsToPrefix.emplace_back(std::move(_statement));
-		return std::move(m_statementsToPrefix);
-	};
-	iterateReplacing(_block.statements, f);
+	}
+	if (modified)
+		_block.statements = std::move(statements);
 
 	swap(saved, m_statementsToPrefix);
 }
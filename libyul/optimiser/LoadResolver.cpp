@@ -26,6 +26,7 @@
 #include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/SideEffects.h>
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
@@ -44,12 +45,24 @@ using namespace solidity::yul;
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
-	LoadResolver{
-		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
-		containsMSize,
-		_context.expectedExecutionsPerDeployment
-	}(_ast);
+	auto functionSideEffects = make_shared<map<YulString, SideEffects> const>(
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+	);
+	bool concurrent = transformTopLevelStatementsConcurrently(_context, _ast, [&](Statement& _statement) {
+		LoadResolver{
+			_context.dialect,
+			functionSideEffects,
+			containsMSize,
+			_context.expectedExecutionsPerDeployment
+		}.visit(_statement);
+	});
+	if (!concurrent)
+		LoadResolver{
+			_context.dialect,
+			functionSideEffects,
+			containsMSize,
+			_context.expectedExecutionsPerDeployment
+		}(_ast);
 }
 
 void LoadResolver::visit(Expression& _e)
@@ -155,7 +155,7 @@ void CodeCost::operator()(Literal const& _literal)
 	case LiteralKind::Boolean:
 		break;
 	case LiteralKind::Number:
-		for (u256 n = u256(_literal.value.str()); n >= 0x100; n >>= 8)
+		for (u256 n = valueOfNumberLiteral(_literal); n >= 0x100; n >>= 8)
 			cost++;
 		break;
 	case LiteralKind::String:
@@ -24,6 +24,11 @@
 #include <string>
 #include <set>
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
 namespace solidity::yul
 {
 
@@ -39,6 +44,8 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// If set, steps that only work inside functions may process functions concurrently.
+	util::ThreadPool* threadPool = nullptr;
 };
 
 
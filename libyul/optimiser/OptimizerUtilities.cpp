@@ -21,6 +21,8 @@
 
 #include <libyul/optimiser/OptimizerUtilities.h>
 
+#include <libyul/optimiser/FunctionGrouper.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <libyul/Dialect.h>
@@ -28,6 +30,7 @@
 
 #include <liblangutil/Token.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Parallel.h>
 
 #include <range/v3/action/remove_if.hpp>
 
@@ -57,3 +60,22 @@ optional<evmasm::Instruction> yul::toEVMInstruction(Dialect const& _dialect, Yul
 			return builtin->instruction;
 	return nullopt;
 }
+
+bool yul::transformTopLevelStatementsConcurrently(
+	OptimiserStepContext const& _context,
+	Block& _ast,
+	function<void(Statement&)> const& _transform
+)
+{
+	if (!_context.threadPool || !FunctionGrouper::alreadyGrouped(_ast))
+		return false;
+
+	vector<exception_ptr> failures = _context.threadPool->parallelFor(
+		_ast.statements.size(),
+		[&](size_t _index) { _transform(_ast.statements[_index]); }
+	);
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+	return true;
+}
@@ -26,6 +26,7 @@
 #include <libyul/Dialect.h>
 #include <libyul/YulString.h>
 
+#include <functional>
 #include <optional>
 
 namespace solidity::evmasm
@@ -36,6 +37,8 @@ enum class Instruction: uint8_t;
 namespace solidity::yul
 {
 
+struct OptimiserStepContext;
+
 /// Removes statements that are just empty blocks (non-recursive).
 void removeEmptyBlocks(Block& _block);
 
@@ -46,4 +49,16 @@ bool isRestrictedIdentifier(Dialect const& _dialect, YulString const& _identifie
 /// Helper function that returns the instruction, if the `_name` is a BuiltinFunction
 std::optional<evmasm::Instruction> toEVMInstruction(Dialect const& _dialect, YulString const& _name);
 
+/// Calls @a _transform on every top-level statement of @a _ast concurrently, using the thread pool
+/// of @a _context. This is only done if the context provides a thread pool and @a _ast is grouped
+/// (see FunctionGrouper), i.e. consists of the main code block followed by function definitions.
+/// Can be used by steps that do not carry any information across function boundaries and do
+/// not create new names, which therefore produce the same result either way.
+/// @returns false if @a _transform was not called because the conditions are not met.
+bool transformTopLevelStatementsConcurrently(
+	OptimiserStepContext const& _context,
+	Block& _ast,
+	std::function<void(Statement&)> const& _transform
+);
+
 }
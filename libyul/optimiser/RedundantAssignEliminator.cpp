@@ -22,6 +22,7 @@
 
 #include <libyul/optimiser/RedundantAssignEliminator.h>
 
+#include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
 
@@ -35,6 +36,16 @@ using namespace solidity::yul;
 
 void RedundantAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
+	bool concurrent = transformTopLevelStatementsConcurrently(_context, _ast, [&](Statement& _statement) {
+		RedundantAssignEliminator rae{_context.dialect};
+		rae.visit(_statement);
+
+		AssignmentRemover remover{rae.m_pendingRemovals};
+		remover.visit(_statement);
+	});
+	if (concurrent)
+		return;
+
 	RedundantAssignEliminator rae{_context.dialect};
 	rae(_ast);
 
@@ -47,7 +47,8 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
+	// The rules store the match groups of the current match, so every thread needs its own copy.
+	static thread_local std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
 
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
@@ -59,8 +60,33 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	vector<Rule> const& candidates = rules.m_rules[uint8_t(instruction->first)];
+	if (candidates.empty())
+		return nullptr;
+
+	// Resolve the arguments only once instead of for every rule.
+	rules.m_argumentShapes.clear();
+	for (Expression const& argument: *instruction->second)
 	{
+		// Patterns never match direct function calls as arguments, see Pattern::matches.
+		if (holds_alternative<FunctionCall>(argument))
+			return nullptr;
+		Expression const* value = &argument;
+		if (Identifier const* identifier = get_if<Identifier>(&argument))
+			if (AssignedValue const* assignedValue = util::valueOrNullptr(_ssaValues, identifier->name))
+				if (assignedValue->value)
+					value = assignedValue->value;
+		ArgumentShape& shape = rules.m_argumentShapes.emplace_back();
+		if (Literal const* literal = get_if<Literal>(value))
+			shape.isConstant = literal->kind == LiteralKind::Number;
+		else if (auto valueInstruction = instructionAndArguments(_dialect, *value))
+			shape.instruction = valueInstruction->first;
+	}
+
+	for (auto const& rule: candidates)
+	{
+		if (!rules.argumentsMayMatch(rule))
+			continue;
 		rules.resetMatchGroups();
 		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
 			if (!rule.feasible || rule.feasible())
@@ -69,6 +95,27 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	return nullptr;
 }
 
+bool SimplificationRules::argumentsMayMatch(Rule const& _rule) const
+{
+	vector<Pattern> const& argumentPatterns = _rule.pattern.arguments();
+	assertThrow(argumentPatterns.size() == m_argumentShapes.size(), OptimizerException, "");
+	for (size_t i = 0; i < argumentPatterns.size(); ++i)
+		switch (argumentPatterns[i].kind())
+		{
+		case PatternKind::Constant:
+			if (!m_argumentShapes[i].isConstant)
+				return false;
+			break;
+		case PatternKind::Operation:
+			if (m_argumentShapes[i].instruction != argumentPatterns[i].instruction())
+				return false;
+			break;
+		case PatternKind::Any:
+			break;
+		}
+	return true;
+}
+
 bool SimplificationRules::isInitialized() const
 {
 	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
@@ -128,7 +175,7 @@ yul::Pattern::Pattern(evmasm::Instruction _instruction, initializer_list<Pattern
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, evmasm::MatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -160,7 +207,7 @@ bool Pattern::matches(
 		Literal const& literal = std::get<Literal>(*expr);
 		if (literal.kind != LiteralKind::Number)
 			return false;
-		if (m_data && *m_data != u256(literal.value.str()))
+		if (m_data && *m_data != valueOfNumberLiteral(literal))
 			return false;
 		assertThrow(m_arguments.empty(), OptimizerException, "");
 	}
@@ -202,11 +249,9 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		if (Expression const* firstMatch = (*m_matchGroups)[m_matchGroup])
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
-			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
-			assertThrow(firstMatch, OptimizerException, "Match set but to null.");
 			assertThrow(
 				!holds_alternative<FunctionCall>(_expr) &&
 				!holds_alternative<FunctionCall>(*firstMatch),
@@ -269,6 +314,7 @@ Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
 	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* matchedExpression = (*m_matchGroups)[m_matchGroup];
+	assertThrow(matchedExpression, OptimizerException, "");
+	return *matchedExpression;
 }
@@ -77,8 +77,20 @@ private:
 
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
+	/// Shape of an argument of the expression to simplify, after resolving SSA variables.
+	/// Used to skip rules whose argument patterns cannot match without trying them.
+	struct ArgumentShape
+	{
+		bool isConstant = false;
+		std::optional<evmasm::Instruction> instruction;
+	};
+	/// @returns false if @a _rule cannot match arguments with the shapes in m_argumentShapes.
+	bool argumentsMayMatch(Rule const& _rule) const;
+
+	evmasm::MatchGroups<Expression> m_matchGroups;
 	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	/// Buffer for the argument shapes of the expression to simplify.
+	std::vector<ArgumentShape> m_argumentShapes;
 };
 
 enum class PatternKind
@@ -113,7 +125,7 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, evmasm::MatchGroups<Expression>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(
 		Expression const& _expr,
@@ -121,7 +133,8 @@ public:
 		std::map<YulString, AssignedValue> const& _ssaValues
 	) const;
 
-	std::vector<Pattern> arguments() const { return m_arguments; }
+	PatternKind kind() const { return m_kind; }
+	std::vector<Pattern> const& arguments() const { return m_arguments; }
 
 	/// @returns the data of the matched expression if this pattern is part of a match group.
 	u256 d() const;
@@ -140,7 +153,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	evmasm::MatchGroups<Expression>* m_matchGroups = nullptr;
 };
 
 }
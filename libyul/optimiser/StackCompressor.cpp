@@ -165,12 +165,15 @@ bool StackCompressor::run(
 		"Need to run the function grouper before the stack compressor."
 	);
 	bool allowMSizeOptimzation = !MSizeFinder::containsMSize(_dialect, *_object.code);
+	// Rematerialisation only changes the functions with a stack deficit, so only those have to
+	// be checked again in the next iteration.
+	map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
 	for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 	{
-		map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
 		if (stackSurplus.empty())
 			return true;
 
+		set<YulString> touchedFunctions;
 		if (stackSurplus.count(YulString{}))
 		{
 			yulAssert(stackSurplus.at({}) > 0, "Invalid surplus value.");
@@ -180,6 +183,7 @@ bool StackCompressor::run(
 				static_cast<size_t>(stackSurplus.at({})),
 				allowMSizeOptimzation
 			);
+			touchedFunctions.insert({});
 		}
 
 		for (size_t i = 1; i < _object.code->statements.size(); ++i)
@@ -195,7 +199,11 @@ bool StackCompressor::run(
 				static_cast<size_t>(stackSurplus.at(fun.name)),
 				allowMSizeOptimzation
 			);
+			touchedFunctions.insert(fun.name);
 		}
+
+		if (iterations + 1 < _maxIterations)
+			stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation, touchedFunctions).stackDeficit;
 	}
 	return false;
 }
@@ -59,6 +59,8 @@ public:
 		PrintChanges
 	};
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// If `_threadPool` is given, some steps process the functions concurrently. This does not
+	/// change the result.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
@@ -66,7 +68,8 @@ public:
 		bool _optimizeStackAllocation,
 		std::string const& _optimisationSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		util::ThreadPool* _threadPool = nullptr
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -91,10 +94,11 @@ private:
 		std::set<YulString> const& _externallyUsedIdentifiers,
 		Debug _debug,
 		Block& _ast,
-		std::optional<size_t> expectedExecutionsPerDeployment
+		std::optional<size_t> expectedExecutionsPerDeployment,
+		util::ThreadPool* _threadPool = nullptr
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
-		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers, expectedExecutionsPerDeployment},
+		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers, expectedExecutionsPerDeployment, _threadPool},
 		m_debug(_debug)
 	{}
 
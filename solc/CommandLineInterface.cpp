@@ -533,7 +533,15 @@ bool CommandLineInterface::processInput()
 			}
 		}
 		StandardCompiler compiler(m_fileReader.reader());
+		unique_ptr<CompilationCache> cache;
+		if (!m_options.cache.directory.empty())
+		{
+			cache = make_unique<CompilationCache>(m_options.cache.directory, uintmax_t(m_options.cache.maxSizeMiB) << 20);
+			compiler.setCache(cache.get());
+		}
 		sout() << compiler.compile(std::move(input)) << endl;
+		if (cache && m_options.cache.printStats)
+			serr() << cache->formatStats() << endl;
 		return true;
 	}
 
@@ -573,6 +581,7 @@ bool CommandLineInterface::compile()
 		m_compiler->setRemappings(m_options.input.remappings);
 		m_compiler->setLibraries(m_options.linker.libraries);
 		m_compiler->setViaIR(m_options.output.experimentalViaIR);
+		m_compiler->setParallelism(m_options.output.jobs);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
 		// TODO: Perhaps we should not compile unless requested
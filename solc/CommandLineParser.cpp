@@ -59,6 +59,9 @@ static string const g_strAst = "ast";
 static string const g_strAstCompactJson = "ast-compact-json";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
+static string const g_strCacheDir = "cache-dir";
+static string const g_strCacheSize = "cache-size";
+static string const g_strCacheStats = "cache-stats";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strErrorRecovery = "error-recovery";
@@ -73,6 +76,7 @@ static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
 static string const g_strInterface = "interface";
+static string const g_strJobs = "jobs";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
 static string const g_strIR = "ir";
@@ -87,6 +91,8 @@ static string const g_strMetadataHash = "metadata-hash";
 static string const g_strMetadataLiteral = "metadata-literal";
 static string const g_strModelCheckerContracts = "model-checker-contracts";
 static string const g_strModelCheckerEngine = "model-checker-engine";
+static string const g_strModelCheckerJobs = "model-checker-jobs";
+static string const g_strModelCheckerRaceSolvers = "model-checker-race-solvers";
 static string const g_strModelCheckerTargets = "model-checker-targets";
 static string const g_strModelCheckerTimeout = "model-checker-timeout";
 static string const g_strNatspecDev = "devdoc";
@@ -275,8 +281,12 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		output.overwriteFiles == _other.output.overwriteFiles &&
 		output.evmVersion == _other.output.evmVersion &&
 		output.experimentalViaIR == _other.output.experimentalViaIR &&
+		output.jobs == _other.output.jobs &&
 		output.revertStrings == _other.output.revertStrings &&
 		output.stopAfter == _other.output.stopAfter &&
+		cache.directory == _other.cache.directory &&
+		cache.maxSizeMiB == _other.cache.maxSizeMiB &&
+		cache.printStats == _other.cache.printStats &&
 		input.mode == _other.input.mode &&
 		assembly.targetMachine == _other.assembly.targetMachine &&
 		assembly.inputLanguage == _other.assembly.inputLanguage &&
@@ -499,6 +509,13 @@ General Information)").c_str(),
 			g_strExperimentalViaIR.c_str(),
 			"Turn on experimental compilation mode via the IR (EXPERIMENTAL)."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			("Use up to n threads to generate code for independent contracts. "
+			"Without --" + g_strExperimentalViaIR + ", only the sub-assemblies of each contract are optimized concurrently. "
+			"The output does not depend on this setting.").c_str()
+		)
 		(
 			g_strRevertStrings.c_str(),
 			po::value<string>()->value_name(boost::join(g_revertStringsArgs, ",")),
@@ -578,6 +595,27 @@ General Information)").c_str(),
 	;
 	desc.add(linkerModeOptions);
 
+	po::options_description standardJsonModeOptions("Standard JSON Mode Options");
+	standardJsonModeOptions.add_options()
+		(
+			g_strCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			"Store the outputs in the given directory and reuse them if the same input is compiled again "
+			"with the same compiler version. The directory can be shared between concurrent invocations."
+		)
+		(
+			g_strCacheSize.c_str(),
+			po::value<unsigned>()->value_name("MiB")->default_value(1024),
+			("Maximum total size of the --" + g_strCacheDir + " directory. "
+			"The least recently used outputs are removed when it is exceeded.").c_str()
+		)
+		(
+			g_strCacheStats.c_str(),
+			"Print cache hit and miss statistics to standard error."
+		)
+	;
+	desc.add(standardJsonModeOptions);
+
 	po::options_description outputFormatting("Output Formatting");
 	outputFormatting.add_options()
 		(
@@ -705,6 +743,19 @@ General Information)").c_str(),
 			"The default is a deterministic resource limit. "
 			"A timeout of 0 means no resource/time restrictions for any query."
 		)
+		(
+			g_strModelCheckerRaceSolvers.c_str(),
+			"Run the available SMT solvers concurrently on each BMC query and stop "
+			"the remaining ones as soon as one of them finds an answer. "
+			"Only has an effect if both Z3 and CVC4 are available."
+		)
+		(
+			g_strModelCheckerJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Check up to n verification targets concurrently, each with its own solver instance. "
+			"The results are reported in the same order. CHC may answer queries that reach "
+			"the resource limit or timeout differently than with a single job."
+		)
 	;
 	desc.add(smtCheckerOptions);
 
@@ -783,6 +834,16 @@ General Information)").c_str(),
 		m_options.output.revertStrings = *revertStrings;
 	}
 
+	if (m_args.count(g_strJobs))
+	{
+		m_options.output.jobs = m_args[g_strJobs].as<unsigned>();
+		if (m_options.output.jobs == 0)
+		{
+			serr() << "Invalid option for --" << g_strJobs << ": Must be at least 1." << endl;
+			return false;
+		}
+	}
+
 	if (!parseCombinedJsonOption())
 		return false;
 
@@ -861,6 +922,23 @@ General Information)").c_str(),
 		return false;
 	}
 
+	if (m_args.count(g_strCacheDir))
+	{
+		if (!m_args.count(g_strStandardJSON))
+		{
+			serr() << "Option --" << g_strCacheDir << " is only supported in --" << g_strStandardJSON << " mode." << endl;
+			return false;
+		}
+		m_options.cache.directory = m_args[g_strCacheDir].as<string>();
+		m_options.cache.maxSizeMiB = m_args[g_strCacheSize].as<unsigned>();
+		m_options.cache.printStats = (m_args.count(g_strCacheStats) > 0);
+	}
+	else if (m_args.count(g_strCacheStats) || !m_args[g_strCacheSize].defaulted())
+	{
+		serr() << "Options --" << g_strCacheSize << " and --" << g_strCacheStats << " require --" << g_strCacheDir << "." << endl;
+		return false;
+	}
+
 	if (m_args.count(g_strStandardJSON))
 	{
 		m_options.input.mode = InputMode::StandardJson;
@@ -1077,12 +1155,26 @@ General Information)").c_str(),
 	if (m_args.count(g_strModelCheckerTimeout))
 		m_options.modelChecker.settings.timeout = m_args[g_strModelCheckerTimeout].as<unsigned>();
 
+	m_options.modelChecker.settings.raceSolvers = (m_args.count(g_strModelCheckerRaceSolvers) > 0);
+
+	if (m_args.count(g_strModelCheckerJobs))
+	{
+		m_options.modelChecker.settings.jobs = m_args[g_strModelCheckerJobs].as<unsigned>();
+		if (m_options.modelChecker.settings.jobs == 0)
+		{
+			serr() << "Invalid option for --" << g_strModelCheckerJobs << ": Must be at least 1." << endl;
+			return false;
+		}
+	}
+
 	m_options.metadata.literalSources = (m_args.count(g_strMetadataLiteral) > 0);
 	m_options.modelChecker.initialize =
 		m_args.count(g_strModelCheckerContracts) ||
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerTargets) ||
-		m_args.count(g_strModelCheckerTimeout);
+		m_args.count(g_strModelCheckerTimeout) ||
+		m_args.count(g_strModelCheckerRaceSolvers) ||
+		m_args.count(g_strModelCheckerJobs);
 	m_options.output.experimentalViaIR = (m_args.count(g_strExperimentalViaIR) > 0);
 	m_options.optimizer.expectedExecutionsPerDeployment = m_args[g_strOptimizeRuns].as<unsigned>();
 
@@ -120,10 +120,18 @@ struct CommandLineOptions
 		bool overwriteFiles = false;
 		langutil::EVMVersion evmVersion;
 		bool experimentalViaIR = false;
+		unsigned jobs = 1;
 		RevertStrings revertStrings = RevertStrings::Default;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
 	} output;
 
+	struct
+	{
+		boost::filesystem::path directory;
+		unsigned maxSizeMiB = 1024;
+		bool printStats = false;
+	} cache;
+
 	struct
 	{
 		yul::AssemblyStack::Machine targetMachine = yul::AssemblyStack::Machine::EVM;
@@ -220,7 +220,8 @@ test_suite* init_unit_test_suite( int /*argc*/, char* /*argv*/[] )
 			"GasMeterTests",
 			"GasCostTests",
 			"SolidityEndToEndTest",
-			"SolidityOptimizer"
+			"SolidityOptimizer",
+			"YulStackLayoutExecution"
 		})
 			removeTestSuite(suite);
 	}
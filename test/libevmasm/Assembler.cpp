@@ -22,6 +22,7 @@
  */
 
 #include <libsolutil/JSON.h>
+#include <libsolutil/Parallel.h>
 #include <libevmasm/Assembly.h>
 
 #include <boost/test/unit_test.hpp>
@@ -280,6 +281,51 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_sub_optimisation)
+{
+	auto createAssembly = []() {
+		auto assembly = make_shared<Assembly>();
+		for (unsigned subIndex = 0; subIndex < 4; ++subIndex)
+		{
+			auto sub = make_shared<Assembly>();
+			AssemblyItem tag = sub->newTag();
+			sub->append(u256(subIndex));
+			sub->append(u256(2));
+			sub->append(Instruction::ADD);
+			sub->appendJump(tag);
+			sub->append(Instruction::STOP);
+			sub->append(tag);
+			sub->append(u256(0));
+			sub->append(Instruction::SLOAD);
+			sub->append(Instruction::POP);
+			AssemblyItem subTag = sub->newTag();
+			sub->append(subTag);
+			sub->append(Instruction::STOP);
+			AssemblyItem pushSub = assembly->appendSubroutine(sub);
+			assembly->append(pushSub);
+			assembly->append(Instruction::POP);
+		}
+		return assembly;
+	};
+
+	Assembly::OptimiserSettings settings;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.runConstantOptimiser = true;
+	settings.isCreation = true;
+
+	shared_ptr<Assembly> sequential = createAssembly();
+	sequential->optimise(settings);
+	shared_ptr<Assembly> concurrent = createAssembly();
+	solidity::util::ThreadPool threadPool(3);
+	concurrent->optimise(settings, &threadPool);
+
+	BOOST_CHECK_EQUAL(concurrent->assemblyString(), sequential->assemblyString());
+	BOOST_CHECK_EQUAL(concurrent->assemble().toHex(), sequential->assemble().toHex());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
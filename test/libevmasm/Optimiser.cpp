@@ -1049,6 +1049,115 @@ BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 	BOOST_CHECK(items.empty());
 }
 
+BOOST_AUTO_TEST_CASE(peephole_double_push_after_pop)
+{
+	AssemblyItems items{
+		u256(0),
+		u256(0xffffffff),
+		Instruction::POP,
+		u256(0),
+		u256(0)
+	};
+	AssemblyItems expectation{
+		u256(0),
+		Instruction::DUP1,
+		Instruction::DUP1
+	};
+	PeepholeOptimiser peepOpt(items);
+	for (size_t i = 0; i < 2; i++)
+		BOOST_CHECK(peepOpt.optimise());
+	BOOST_CHECK(!peepOpt.optimise());
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(peephole_later_passes_match_full_passes)
+{
+	// Changes at the start, in the middle and at the end, some of which only
+	// become possible after an earlier pass.
+	AssemblyItems items{
+		u256(0),
+		u256(0xffffffff),
+		Instruction::POP,
+		u256(0),
+		u256(0)
+	};
+	for (size_t i = 0; i < 100; i++)
+		items.emplace_back(Instruction::ADD);
+	items += AssemblyItems{u256(1), u256(2), Instruction::SWAP1, Instruction::SWAP1, Instruction::LT, Instruction::POP};
+	for (size_t i = 0; i < 100; i++)
+		items.emplace_back(Instruction::ADD);
+	items += AssemblyItems{Instruction::ISZERO, Instruction::ISZERO, Instruction::POP, u256(3), Instruction::POP};
+
+	// A new optimiser examines all items in its first pass.
+	AssemblyItems expectation = items;
+	size_t fullPasses = 0;
+	while (PeepholeOptimiser(expectation).optimise())
+		fullPasses++;
+
+	PeepholeOptimiser peepOpt(items);
+	size_t passes = 0;
+	while (peepOpt.optimise())
+		passes++;
+
+	BOOST_CHECK_GT(passes, 1);
+	BOOST_CHECK_EQUAL(passes, fullPasses);
+	BOOST_CHECK_LT(items.size(), 211);
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(peephole_double_push_swap_comparison)
+{
+	AssemblyItems items{
+		u256(1),
+		u256(1),
+		Instruction::SWAP1,
+		Instruction::LT
+	};
+	AssemblyItems expectation{
+		u256(1),
+		Instruction::DUP1,
+		Instruction::GT
+	};
+	PeepholeOptimiser peepOpt(items);
+	BOOST_CHECK(peepOpt.optimise());
+	BOOST_CHECK(!peepOpt.optimise());
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(peephole_pop_of_operation_with_popped_arguments)
+{
+	AssemblyItems items{
+		Instruction::SWAP1,
+		u256(0xffffffff),
+		Instruction::POP,
+		Instruction::DUP2,
+		Instruction::POP,
+		Instruction::AND,
+		Instruction::POP
+	};
+	AssemblyItems expectation{
+		Instruction::SWAP1,
+		Instruction::POP,
+		Instruction::POP
+	};
+	PeepholeOptimiser peepOpt(items);
+	BOOST_CHECK(peepOpt.optimise());
+	BOOST_CHECK(!peepOpt.optimise());
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
 BOOST_AUTO_TEST_CASE(peephole_commutative_swap1)
 {
 	vector<Instruction> ops{
@@ -48,6 +48,29 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(line_column)
+{
+	CharStream const source("ab\ncd\r\n\nefg", "source");
+
+	BOOST_CHECK((source.lineStarts() == std::vector<size_t>{0, 3, 7, 8}));
+	BOOST_CHECK((source.translatePositionToLineColumn(0) == std::tuple<int, int>{0, 0}));
+	BOOST_CHECK((source.translatePositionToLineColumn(2) == std::tuple<int, int>{0, 2}));
+	BOOST_CHECK((source.translatePositionToLineColumn(3) == std::tuple<int, int>{1, 0}));
+	BOOST_CHECK((source.translatePositionToLineColumn(7) == std::tuple<int, int>{2, 0}));
+	BOOST_CHECK((source.translatePositionToLineColumn(10) == std::tuple<int, int>{3, 2}));
+	BOOST_CHECK((source.translatePositionToLineColumn(100) == std::tuple<int, int>{3, 3}));
+	BOOST_CHECK((
+		source.translatePositionsToLineColumns({4, 8}) ==
+		std::vector<std::tuple<int, int>>{{1, 1}, {3, 0}}
+	));
+
+	BOOST_CHECK_EQUAL(source.lineAtPosition(0), "ab");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(2), "ab");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(4), "cd");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(7), "");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(9), "efg");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
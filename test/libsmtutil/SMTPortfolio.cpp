@@ -0,0 +1,181 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the portfolio of SMT solvers.
+ */
+
+#include <libsmtutil/SMTPortfolio.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::smtutil::test
+{
+
+namespace
+{
+
+using Result = pair<CheckResult, vector<string>>;
+
+/// @returns the results of a few queries to @a _portfolio. Every query that is satisfiable
+/// has a unique model, so the values do not depend on the solver that answered.
+vector<Result> check(SMTPortfolio& _portfolio)
+{
+	Expression x = _portfolio.newVariable("x", SortProvider::sintSort);
+	Expression y = _portfolio.newVariable("y", SortProvider::sintSort);
+	Expression b = _portfolio.newVariable("b", SortProvider::boolSort);
+
+	vector<Result> results;
+	auto query = [&](Expression const& _assertion) {
+		_portfolio.push();
+		_portfolio.addAssertion(_assertion);
+		results.emplace_back(_portfolio.check({x, y, b}));
+		_portfolio.pop();
+	};
+	query(x + 1 == 5 && y == x * 2 && b == (x > y));
+	query(x > 2 && x < 2);
+	query(x * x == 49 && x > 0 && y == x + 10 && b);
+	query(Expression::implies(b, x == 3) && b && x != 3);
+	query(x >= 0 && x < 1 && y == Expression::ite(x == 0, x + 8, x) && !b);
+	return results;
+}
+
+/// Solver that immediately gives a fixed answer.
+class FixedAnswerSolver: public SolverInterface
+{
+public:
+	explicit FixedAnswerSolver(Result _answer): m_answer(move(_answer)) {}
+	void reset() override {}
+	void push() override {}
+	void pop() override {}
+	void declareVariable(string const&, SortPointer const&) override {}
+	void addAssertion(Expression const&) override {}
+	Result check(vector<Expression> const&) override { return m_answer; }
+
+private:
+	Result m_answer;
+};
+
+/// Solver whose checks only return once they are interrupted.
+class BlockingSolver: public SolverInterface
+{
+public:
+	void reset() override {}
+	void push() override {}
+	void pop() override {}
+	void declareVariable(string const&, SortPointer const&) override {}
+	void addAssertion(Expression const&) override {}
+	Result check(vector<Expression> const&) override
+	{
+		unique_lock<mutex> lock(m_mutex);
+		m_checking = true;
+		m_interrupted.wait(lock, [&]() { return m_interruptions > 0; });
+		m_checking = false;
+		return {CheckResult::UNKNOWN, {}};
+	}
+	void interrupt() override
+	{
+		lock_guard<mutex> lock(m_mutex);
+		if (!m_checking)
+			return;
+		++m_interruptions;
+		m_interrupted.notify_all();
+	}
+	size_t interruptions()
+	{
+		lock_guard<mutex> lock(m_mutex);
+		return m_interruptions;
+	}
+
+private:
+	mutex m_mutex;
+	condition_variable m_interrupted;
+	bool m_checking = false;
+	size_t m_interruptions = 0;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTPortfolioTest)
+
+BOOST_AUTO_TEST_CASE(racing_solvers_gives_same_results)
+{
+	SMTPortfolio sequential({}, {}, SMTSolverChoice::All(), nullopt, false);
+	SMTPortfolio racing({}, {}, SMTSolverChoice::All(), nullopt, true);
+	// Apart from the SMT-LIB2 interface, which cannot answer here, at least one solver is needed.
+	// The race is only run between solvers that actually check the queries if both Z3 and CVC4 are linked.
+	if (racing.solvers() < 2)
+		return;
+
+	vector<Result> expected = check(sequential);
+	BOOST_CHECK(expected == (vector<Result>{
+		{CheckResult::SATISFIABLE, {"4", "8", "false"}},
+		{CheckResult::UNSATISFIABLE, {}},
+		{CheckResult::SATISFIABLE, {"7", "17", "true"}},
+		{CheckResult::UNSATISFIABLE, {}},
+		{CheckResult::SATISFIABLE, {"0", "8", "false"}}
+	}));
+	// The solvers are interrupted at different points every time, so race several times.
+	for (size_t i = 0; i < 20; ++i)
+		BOOST_CHECK(check(racing) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(race_interrupts_slow_solver)
+{
+	Result const answer{CheckResult::SATISFIABLE, {"42"}};
+	for (size_t i = 0; i < 20; ++i)
+	{
+		auto slowSolver = make_unique<BlockingSolver>();
+		BlockingSolver& slow = *slowSolver;
+		vector<unique_ptr<SolverInterface>> solvers;
+		solvers.emplace_back(make_unique<FixedAnswerSolver>(answer));
+		solvers.emplace_back(move(slowSolver));
+		SMTPortfolio racing(move(solvers), nullopt, true);
+
+		BOOST_CHECK(racing.check({}) == answer);
+		BOOST_CHECK(slow.interruptions() > 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(copy_leaves_out_smtlib2_interface)
+{
+	SMTPortfolio portfolio({}, {}, SMTSolverChoice::All(), nullopt, false);
+	BOOST_CHECK(!portfolio.answersSMTLib2Queries());
+	auto callback = [](string const&, string const&) { return frontend::ReadCallback::Result{}; };
+	BOOST_CHECK(SMTPortfolio({}, callback).answersSMTLib2Queries());
+	if (portfolio.solvers() < 2)
+		return;
+
+	Expression x = portfolio.newVariable("x", SortProvider::sintSort);
+	auto copy = portfolio.copy({x});
+	BOOST_CHECK_EQUAL(copy->solvers(), portfolio.solvers() - 1);
+	copy->addAssertion(x * 2 == 6);
+	BOOST_CHECK(copy->check({x}) == (Result{CheckResult::SATISFIABLE, {"3"}}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,171 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for interface/CompilationCache.h.
+ */
+
+#include <libsolidity/interface/CompilationCache.h>
+#include <libsolidity/interface/StandardCompiler.h>
+
+#include <test/TemporaryDirectory.h>
+
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace std;
+using namespace solidity::util;
+using namespace solidity::test;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+Json::Value parse(string const& _json)
+{
+	Json::Value result;
+	BOOST_REQUIRE(jsonParseStrict(_json, result));
+	return result;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(CompilationCacheTest)
+
+BOOST_AUTO_TEST_CASE(store_and_lookup)
+{
+	TemporaryDirectory tempDir;
+	CompilationCache cache(tempDir.path() / "cache", 1 << 20);
+	Json::Value output = parse(R"({"contracts": {"a.sol": {}}})");
+	h256 key = CompilationCache::key(parse(R"({"language": "Solidity"})"));
+
+	BOOST_CHECK(!cache.lookup(key, {}));
+	cache.store(key, output, {});
+	optional<Json::Value> cached = cache.lookup(key, {});
+	BOOST_REQUIRE(cached);
+	BOOST_CHECK(*cached == output);
+
+	BOOST_CHECK_EQUAL(cache.stats().hits, 1);
+	BOOST_CHECK_EQUAL(cache.stats().misses, 1);
+	BOOST_CHECK_EQUAL(cache.stats().stores, 1);
+	BOOST_CHECK_EQUAL(cache.stats().evictions, 0);
+}
+
+BOOST_AUTO_TEST_CASE(key_ignores_parallelism)
+{
+	Json::Value input = parse(R"({"language": "Solidity", "settings": {"optimizer": {"enabled": true}}})");
+	Json::Value parallelInput = input;
+	parallelInput["settings"]["parallelism"] = 4;
+	Json::Value unoptimizedInput = input;
+	unoptimizedInput["settings"]["optimizer"]["enabled"] = false;
+
+	BOOST_CHECK(CompilationCache::key(input) == CompilationCache::key(parallelInput));
+	BOOST_CHECK(CompilationCache::key(input) != CompilationCache::key(unoptimizedInput));
+}
+
+BOOST_AUTO_TEST_CASE(file_reads_are_validated)
+{
+	TemporaryDirectory tempDir;
+	CompilationCache cache(tempDir.path(), 1 << 20);
+	h256 key = CompilationCache::key(parse(R"({"language": "Solidity"})"));
+	string content = "contract C {}";
+	cache.store(key, parse("{}"), {{"source", "a.sol", true, keccak256(content)}});
+
+	auto readFile = [&](string const&, string const&) { return ReadCallback::Result{true, content}; };
+	BOOST_CHECK(cache.lookup(key, readFile));
+	BOOST_CHECK(!cache.lookup(key, {}));
+	content = "contract D {}";
+	BOOST_CHECK(!cache.lookup(key, readFile));
+}
+
+BOOST_AUTO_TEST_CASE(eviction)
+{
+	TemporaryDirectory tempDir;
+	// Large enough that only a single entry fits into the cache.
+	CompilationCache cache(tempDir.path(), 1500);
+	Json::Value output = Json::objectValue;
+	output["padding"] = string(1000, 'x');
+
+	vector<h256> keys;
+	for (int i = 0; i < 4; ++i)
+	{
+		Json::Value input = Json::objectValue;
+		input["index"] = i;
+		keys.push_back(CompilationCache::key(input));
+		cache.store(keys.back(), output, {});
+	}
+
+	BOOST_CHECK_EQUAL(cache.stats().evictions, 3);
+	BOOST_CHECK(!cache.lookup(keys[2], {}));
+	BOOST_CHECK(cache.lookup(keys[3], {}));
+}
+
+BOOST_AUTO_TEST_CASE(standard_compiler)
+{
+	TemporaryDirectory tempDir;
+	CompilationCache cache(tempDir.path(), 1 << 20);
+	string input = R"({
+		"language": "Solidity",
+		"sources": {"a.sol": {"content": "contract A { function f() public {} }"}},
+		"settings": {"outputSelection": {"*": {"*": ["abi", "evm.bytecode.object"]}}}
+	})";
+
+	StandardCompiler uncachedCompiler;
+	string expected = uncachedCompiler.compile(input);
+
+	StandardCompiler compiler;
+	compiler.setCache(&cache);
+	BOOST_CHECK_EQUAL(compiler.compile(input), expected);
+	BOOST_CHECK_EQUAL(compiler.compile(input), expected);
+	BOOST_CHECK_EQUAL(cache.stats().misses, 1);
+	BOOST_CHECK_EQUAL(cache.stats().hits, 1);
+}
+
+BOOST_AUTO_TEST_CASE(standard_compiler_does_not_cache_exceptions)
+{
+	TemporaryDirectory tempDir;
+	CompilationCache cache(tempDir.path(), 1 << 20);
+	string input = R"({
+		"language": "Solidity",
+		"sources": {"a.sol": {"content": "import \"b.sol\"; contract A {}"}},
+		"settings": {"outputSelection": {"*": {"*": ["abi"]}}}
+	})";
+
+	// Simulates running out of memory while compiling.
+	auto readFile = [](string const&, string const&) -> ReadCallback::Result { throw std::bad_alloc(); };
+	StandardCompiler compiler(readFile);
+	compiler.setCache(&cache);
+	for (size_t i = 0; i < 2; ++i)
+	{
+		Json::Value output = parse(compiler.compile(input));
+		BOOST_REQUIRE(output["errors"].isArray() && output["errors"].size() == 1);
+		BOOST_CHECK(output["errors"][0]["type"] == "Exception");
+	}
+	BOOST_CHECK_EQUAL(cache.stats().misses, 2);
+	BOOST_CHECK_EQUAL(cache.stats().hits, 0);
+	BOOST_CHECK_EQUAL(cache.stats().stores, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
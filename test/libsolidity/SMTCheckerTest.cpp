@@ -51,6 +51,10 @@ SMTCheckerTest::SMTCheckerTest(string const& _filename): SyntaxTest(_filename, E
 	else
 		BOOST_THROW_EXCEPTION(runtime_error("Invalid SMT engine choice."));
 
+	m_modelCheckerSettings.jobs = static_cast<unsigned>(m_reader.sizetSetting("SMTJobs", 1));
+	if (m_modelCheckerSettings.jobs == 0)
+		BOOST_THROW_EXCEPTION(runtime_error("Invalid number of SMT jobs."));
+
 	if (m_enabledSolvers.none() || m_modelCheckerSettings.engine.none())
 		m_shouldRun = false;
 
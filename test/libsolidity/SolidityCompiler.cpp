@@ -22,6 +22,8 @@
 #include <test/Metadata.h>
 #include <test/Common.h>
 
+#include <libevmasm/AssemblyItem.h>
+
 #include <boost/test/unit_test.hpp>
 
 using namespace std;
@@ -51,6 +53,37 @@ BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions)
 	BOOST_CHECK(runtimeBytecode.size() <= 30);
 }
 
+BOOST_AUTO_TEST_CASE(via_ir_assembly_locations_refer_to_optimized_ir)
+{
+	char const* sourceCode = R"(
+		// SPDX-License-Identifier: GPL-3.0
+		pragma solidity >=0.0;
+		contract C {
+			function f(uint x) public pure returns (uint) { return x + 1; }
+		}
+	)";
+	CompilerStack compiler;
+	compiler.setSources({{"", sourceCode}});
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	compiler.setViaIR(true);
+	compiler.enableIRGeneration();
+	BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+
+	string const& optimizedIR = compiler.yulIROptimized("C");
+	size_t irLocations = 0;
+	for (evmasm::AssemblyItems const* items: {compiler.assemblyItems("C"), compiler.runtimeAssemblyItems("C")})
+	{
+		BOOST_REQUIRE(items);
+		for (evmasm::AssemblyItem const& item: *items)
+			if (item.location().source && item.location().source->name().empty())
+			{
+				++irLocations;
+				BOOST_CHECK(item.location().source->source() == optimizedIR);
+			}
+	}
+	BOOST_CHECK(irLocations > 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -218,6 +218,44 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(shared_types)
+{
+	Type const* uint256 = TypeProvider::uint256();
+	ArrayType const* memoryArray = TypeProvider::array(DataLocation::Memory, uint256);
+	BOOST_CHECK_EQUAL(memoryArray, TypeProvider::array(DataLocation::Memory, uint256));
+	BOOST_CHECK(memoryArray != TypeProvider::array(DataLocation::Memory, uint256, 2));
+
+	ArrayType const* storageArray = TypeProvider::array(DataLocation::Storage, uint256);
+	BOOST_CHECK_EQUAL(TypeProvider::withLocation(storageArray, DataLocation::Memory, true), memoryArray);
+	BOOST_CHECK_EQUAL(TypeProvider::withLocation(memoryArray, DataLocation::Storage, true), storageArray);
+
+	ReferenceType const* storageRef = TypeProvider::withLocation(memoryArray, DataLocation::Storage, false);
+	BOOST_CHECK(!storageRef->isPointer());
+	BOOST_CHECK_EQUAL(TypeProvider::withLocation(storageArray, DataLocation::Storage, false), storageRef);
+
+	// Nested reference types are converted before they are looked up.
+	ArrayType const* nested = TypeProvider::array(DataLocation::Memory, storageArray, 3);
+	BOOST_CHECK_EQUAL(nested, TypeProvider::array(DataLocation::Memory, memoryArray, 3));
+	BOOST_CHECK_EQUAL(nested->baseType(), memoryArray);
+
+	BOOST_CHECK_EQUAL(TypeProvider::array(DataLocation::CallData), TypeProvider::bytesCalldata());
+	BOOST_CHECK_EQUAL(
+		TypeProvider::mapping(uint256, storageArray),
+		TypeProvider::mapping(uint256, storageArray)
+	);
+	BOOST_CHECK_EQUAL(
+		TypeProvider::tuple({uint256, nullptr, memoryArray}),
+		TypeProvider::tuple({uint256, nullptr, memoryArray})
+	);
+	BOOST_CHECK_EQUAL(
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::Internal),
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::Internal)
+	);
+	BOOST_CHECK_EQUAL(TypeProvider::rationalNumber(rational(7, 2)), TypeProvider::rationalNumber(rational(14, 4)));
+
+	TypeProvider::reset();
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
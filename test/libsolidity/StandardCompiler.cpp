@@ -1758,6 +1758,107 @@ BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract_yul)
 	BOOST_REQUIRE(result["sources"].size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_invalid_value)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{ "": { "content": "pragma solidity >=0.0; contract C { function f() public pure {} }" } },
+		"settings":
+		{
+			"parallelism": 0,
+			"outputSelection":
+			{
+				"*": { "C": ["evm.bytecode"] }
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive integer."));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_via_ir_same_output)
+{
+	auto compileWithParallelism = [](unsigned _parallelism)
+	{
+		string input = R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": {
+					"content": "contract A { function f(uint x) public pure returns (uint) { return x + 1; } } contract B { A a = new A(); } contract C { function g(bytes memory b) public pure returns (bytes32) { return keccak256(b); } } contract F { function f() public { new A(); new B(); new C(); } }"
+				}
+			},
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true },
+				"parallelism": )" + to_string(_parallelism) + R"(,
+				"outputSelection": {
+					"A.sol": {
+						"*": ["evm.bytecode.object", "evm.deployedBytecode.object"]
+					}
+				}
+			}
+		}
+		)";
+		Json::Value parsedInput;
+		BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+		solidity::frontend::StandardCompiler compiler;
+		Json::Value result = compiler.compile(parsedInput);
+		BOOST_REQUIRE(containsAtMostWarnings(result));
+		return result["contracts"];
+	};
+
+	Json::Value sequential = compileWithParallelism(1);
+	Json::Value parallel = compileWithParallelism(4);
+	BOOST_REQUIRE(sequential["A.sol"].size() == 4);
+	BOOST_CHECK(sequential == parallel);
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_via_ir_same_failure)
+{
+	// A fails when translating its IR to EVM assembly (stack too deep without optimizer),
+	// B already fails when generating its IR. Sequential compilation only reaches A.
+	auto compileWithParallelism = [](unsigned _parallelism)
+	{
+		string input = R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": {
+					"content": "contract A { function f(uint a1, uint a2, uint a3, uint a4, uint a5, uint a6, uint a7, uint a8, uint a9, uint a10, uint a11, uint a12, uint a13, uint a14, uint a15, uint a16, uint a17, uint a18, uint a19, uint a20) public pure returns (uint r) { r = a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12 + a13 + a14 + a15 + a16 + a17 + a18 + a19 + a20; } } contract B { function g() public pure { fixed16x2 a = 0; a; } }"
+				}
+			},
+			"settings": {
+				"viaIR": true,
+				"parallelism": )" + to_string(_parallelism) + R"(,
+				"outputSelection": {
+					"A.sol": {
+						"*": ["evm.bytecode.object"]
+					}
+				}
+			}
+		}
+		)";
+		Json::Value parsedInput;
+		BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+		solidity::frontend::StandardCompiler compiler;
+		return compiler.compile(parsedInput)["errors"];
+	};
+
+	Json::Value sequential = compileWithParallelism(1);
+	Json::Value parallel = compileWithParallelism(4);
+	BOOST_REQUIRE(sequential.isArray() && sequential.size() >= 1);
+	Json::Value const& error = sequential[sequential.size() - 1];
+	BOOST_CHECK(error["type"] == "YulException");
+	BOOST_CHECK(error["message"].asString().find("too deep") != string::npos);
+	BOOST_CHECK(sequential == parallel);
+}
+
 BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 {
 	char const* input = R"(
@@ -0,0 +1,18 @@
+contract C {
+	function f(uint x, uint y) public pure returns (uint) {
+		uint z = x / y;
+		assert(z < 10);
+		assert(x >= z); // should hold
+		if (y >= 0)
+			return z + x;
+		return 0;
+	}
+}
+// ====
+// SMTEngine: bmc
+// SMTJobs: 4
+// ----
+// Warning 6838: (145-151): BMC: Condition is always true.
+// Warning 3046: (81-86): BMC: Division by zero happens here.
+// Warning 4661: (90-104): BMC: Assertion violation happens here.
+// Warning 2661: (163-168): BMC: Overflow (resulting value larger than 2**256 - 1) happens here.
@@ -0,0 +1,16 @@
+contract C {
+	function f(uint x, uint y) public pure returns (uint) {
+		uint z = x / y;
+		assert(z < 10);
+		assert(x >= z); // should hold
+		return z + x;
+	}
+}
+// ====
+// SMTEngine: chc
+// SMTIgnoreCex: yes
+// SMTJobs: 1
+// ----
+// Warning 4281: (81-86): CHC: Division by zero happens here.
+// Warning 6328: (90-104): CHC: Assertion violation happens here.
+// Warning 4984: (148-153): CHC: Overflow (resulting value larger than 2**256 - 1) happens here.
@@ -138,6 +138,27 @@ BOOST_AUTO_TEST_CASE(test_format_number)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(twos_complement)
+{
+	u256 const minusOne = ~u256(0);
+	u256 const minValue = u256(1) << 255;
+	u256 const maxValue = minValue - 1;
+
+	BOOST_CHECK(u2s(0) == 0);
+	BOOST_CHECK(u2s(1) == 1);
+	BOOST_CHECK(u2s(minusOne) == -1);
+	BOOST_CHECK(u2s(maxValue) == s256(maxValue));
+	BOOST_CHECK(u2s(minValue) == -s256(minValue));
+
+	BOOST_CHECK(s2u(0) == 0);
+	BOOST_CHECK(s2u(-1) == minusOne);
+	BOOST_CHECK(s2u(s256(maxValue)) == maxValue);
+	BOOST_CHECK(s2u(-s256(minValue)) == minValue);
+
+	for (u256 value: {u256(0), u256(7), minusOne, minValue, maxValue, minusOne - 7})
+		BOOST_CHECK(s2u(u2s(value)) == value);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(Parallel)
+
+BOOST_AUTO_TEST_CASE(all_indices_run_once)
+{
+	for (size_t threads: {1u, 2u, 8u})
+	{
+		vector<atomic<int>> calls(100);
+		vector<exception_ptr> failures = parallelFor(calls.size(), threads, [&](size_t _index) { ++calls[_index]; });
+		BOOST_CHECK_EQUAL(failures.size(), calls.size());
+		for (size_t i = 0; i < calls.size(); ++i)
+		{
+			BOOST_CHECK(!failures[i]);
+			BOOST_CHECK_EQUAL(calls[i].load(), 1);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(exceptions_are_returned_per_index)
+{
+	vector<exception_ptr> failures = parallelFor(10, 4, [](size_t _index) {
+		if (_index % 3 == 0)
+			throw runtime_error(to_string(_index));
+	});
+	for (size_t i = 0; i < failures.size(); ++i)
+	{
+		BOOST_REQUIRE_EQUAL(bool(failures[i]), i % 3 == 0);
+		if (failures[i])
+			BOOST_CHECK_EXCEPTION(rethrow_exception(failures[i]), runtime_error, [&](runtime_error const& _error) {
+				return _error.what() == to_string(i);
+			});
+	}
+}
+
+BOOST_AUTO_TEST_CASE(nested_batches)
+{
+	ThreadPool pool(3);
+	atomic<size_t> sum{0};
+	vector<exception_ptr> failures = pool.parallelFor(8, [&](size_t _outer) {
+		for (exception_ptr const& failure: pool.parallelFor(8, [&](size_t _inner) { sum += _outer * 8 + _inner; }))
+			if (failure)
+				rethrow_exception(failure);
+	});
+	for (exception_ptr const& failure: failures)
+		BOOST_CHECK(!failure);
+	BOOST_CHECK_EQUAL(sum.load(), 63u * 64u / 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
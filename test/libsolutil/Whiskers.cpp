@@ -208,6 +208,26 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_tags_rendered)
+{
+	string templ = "a <#l> x </m> <?c>y <!c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ).render(), templ);
+}
+
+BOOST_AUTO_TEST_CASE(nested_conditionals)
+{
+	string templ = "<?c>1<?d>2<!d>3</d><!c>4</c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("d", false).render(), "13");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false)("d", true).render(), "4");
+}
+
+BOOST_AUTO_TEST_CASE(same_template_different_values)
+{
+	string templ = "<?c>A<!c>B</c><x>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("x", "1").render(), "A1");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false)("x", "2").render(), "B2");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -34,12 +34,15 @@ namespace solidity::yul::test
 
 namespace
 {
-string check(string const& _input)
+string check(string const& _input, optional<set<YulString>> const& _functionsToCheck = nullopt)
 {
 	Object obj;
 	std::tie(obj.code, obj.analysisInfo) = yul::test::parse(_input, false);
 	BOOST_REQUIRE(obj.code);
-	auto functions = CompilabilityChecker(EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()), obj, true).stackDeficit;
+	EVMDialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	auto functions = _functionsToCheck ?
+		CompilabilityChecker(dialect, obj, true, *_functionsToCheck).stackDeficit :
+		CompilabilityChecker(dialect, obj, true).stackDeficit;
 	string out;
 	for (auto const& function: functions)
 		out += function.first.str() + ": " + to_string(function.second) + " ";
@@ -335,6 +338,47 @@ BOOST_AUTO_TEST_CASE(also_in_outer_block_unused_arguments)
 	BOOST_CHECK_EQUAL(out, ": 9 ");
 }
 
+BOOST_AUTO_TEST_CASE(only_selected_functions)
+{
+	// Grouped form as produced by the function grouper.
+	string const source = R"({
+		{
+			let x := 0
+			let r1 := 0
+			let r2 := 0
+			let r3 := 0
+			let r4 := 0
+			let r5 := 0
+			let r6 := 0
+			let r7 := 0
+			let r8 := 0
+			let r9 := 0
+			let r10 := 0
+			let r11 := 0
+			let r12 := 0
+			let r13 := 0
+			let r14 := 0
+			let r15 := 0
+			let r16 := 0
+			let r17 := 0
+			let r18 := 0
+			x := add(add(add(add(add(add(add(add(add(add(add(add(x, r12), r11), r10), r9), r8), r7), r6), r5), r4), r3), r2), r1)
+			sstore(0, f(x, 1))
+		}
+		function f(a, b) -> c {
+			c := g(a, b, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+		}
+		function g(s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12, s13, s14, s15, s16, s17, s18, s19) -> w {
+			w := add(s1, s2)
+		}
+	})";
+	BOOST_CHECK_EQUAL(check(source), "g: 4 f: 5 : 9 ");
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{YulString{"g"}}), "g: 4 ");
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{YulString{}}), ": 9 ");
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{YulString{"f"}}), "f: 5 ");
+	BOOST_CHECK_EQUAL(check(source, set<YulString>{}), "");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,163 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for optimising Yul code on a thread pool.
+ */
+
+#include <test/Common.h>
+#include <test/libyul/Common.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/AST.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/FunctionGrouper.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity::frontend;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string const source = R"(
+	object "A" {
+		code {
+			function f(a, b) -> c {
+				c := add(a, b)
+				c := mul(c, 1)
+				let d := add(a, b)
+				if gt(d, c) { c := d }
+				mstore(0, c)
+				c := add(mload(0), sub(d, d))
+			}
+			function g(x) -> y {
+				y := x
+				for { let i := 0 } lt(i, 3) { i := add(i, 1) } {
+					y := add(y, and(x, 0xff))
+					sstore(i, y)
+					y := sload(i)
+				}
+				y := y
+			}
+			function h(x) {
+				let t := calldataload(x)
+				mstore(64, t)
+				sstore(x, mload(64))
+				t := 7
+			}
+			h(f(calldataload(0), g(calldataload(32))))
+			datacopy(0, dataoffset("A_deployed"), datasize("A_deployed"))
+			return(0, datasize("A_deployed"))
+		}
+		object "A_deployed" {
+			code {
+				function p(a) -> b {
+					b := add(a, mul(2, 3))
+					b := add(a, mul(2, 3))
+					sstore(b, add(a, mul(2, 3)))
+				}
+				function q(a) -> b {
+					mstore(a, 1)
+					b := mload(a)
+					b := add(b, 0)
+				}
+				sstore(0, p(q(calldataload(0))))
+			}
+		}
+	}
+)";
+
+/// Optimises @a source with @a _steps and @returns the result.
+string optimise(string const& _steps, util::ThreadPool* _threadPool)
+{
+	OptimiserSettings settings = OptimiserSettings::full();
+	settings.yulOptimiserSteps = _steps;
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		settings
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", source));
+	stack.optimize(_threadPool);
+	return stack.print();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulConcurrentOptimisation)
+
+BOOST_AUTO_TEST_CASE(transform_top_level_statements)
+{
+	Dialect const& evmDialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	Block ast = disambiguate(R"({
+		sstore(0, 1)
+		function f() {}
+		function g() {}
+		function h() {}
+	})", false);
+	set<YulString> reservedIdentifiers;
+	NameDispenser dispenser{evmDialect, ast};
+	util::ThreadPool threadPool(3);
+	OptimiserStepContext context{evmDialect, dispenser, reservedIdentifiers, 200, nullptr};
+
+	vector<size_t> calls(ast.statements.size(), 0);
+	auto transform = [&](Statement& _statement) { ++calls[size_t(&_statement - ast.statements.data())]; };
+
+	// Without a thread pool or before grouping, the caller has to transform the code itself.
+	BOOST_CHECK(!transformTopLevelStatementsConcurrently(context, ast, transform));
+	context.threadPool = &threadPool;
+	BOOST_CHECK(!transformTopLevelStatementsConcurrently(context, ast, transform));
+	BOOST_CHECK(calls == vector<size_t>(calls.size(), 0));
+
+	FunctionGrouper::run(context, ast);
+	calls.assign(ast.statements.size(), 0);
+	BOOST_CHECK(transformTopLevelStatementsConcurrently(context, ast, transform));
+	BOOST_CHECK(calls == vector<size_t>(calls.size(), 1));
+}
+
+BOOST_AUTO_TEST_CASE(same_result_with_thread_pool)
+{
+	util::ThreadPool threadPool(4);
+	// The steps that process functions concurrently, on their own, after SSA transform
+	// and as part of the default sequence.
+	for (string steps: {
+		"r", "L", "s", "c",
+		"ar", "aL", "as", "ac",
+		OptimiserSettings::DefaultYulOptimiserSteps
+	})
+		BOOST_CHECK_EQUAL(optimise(steps, &threadPool), optimise(steps, nullptr));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -576,6 +576,25 @@ BOOST_AUTO_TEST_CASE(customSourceLocations_reference_original_sloc)
 	CHECK_LOCATION(varDecl.debugData->location, "", 10, 20);
 }
 
+BOOST_AUTO_TEST_CASE(debug_data_is_shared)
+{
+	ErrorList errorList;
+	ErrorReporter reporter(errorList);
+	auto scanner = make_shared<Scanner>(CharStream("{ let x := add(1, 2) }", ""));
+	SourceLocation location{3, 7, scanner->charStream()};
+	shared_ptr<Block> result = yul::Parser(reporter, EVMDialect::strictAssemblyForEVM(EVMVersion{}), location).parse(scanner, false);
+	BOOST_REQUIRE(!!result);
+	BOOST_REQUIRE(holds_alternative<VariableDeclaration>(result->statements.at(0)));
+	VariableDeclaration const& varDecl = get<VariableDeclaration>(result->statements.at(0));
+	// All nodes parsed with a location override share the same debug data.
+	BOOST_CHECK(varDecl.debugData == result->debugData);
+	BOOST_CHECK(varDecl.variables.at(0).debugData == result->debugData);
+	BOOST_CHECK(debugDataOf(*varDecl.value) == result->debugData);
+	CHECK_LOCATION(result->debugData->location, "{ let x := add(1, 2) }", 3, 7);
+
+	BOOST_CHECK(DebugData::create() == DebugData::create(SourceLocation{}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,400 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the stack shuffling and the CFG-based EVM code transform.
+ */
+
+#include <test/Common.h>
+#include <test/ExecutionFramework.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/backends/evm/StackHelpers.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+
+using namespace std;
+using namespace solidity::frontend;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// Shuffles @a _current into @a _target and checks that every operation is valid and
+/// that the result matches @a _target.
+void checkShuffle(Stack const& _current, Stack const& _target)
+{
+	Stack stack = _current;
+	Stack simulated = _current;
+	createStackLayout(
+		stack,
+		_target,
+		[&](unsigned _depth) {
+			BOOST_REQUIRE(_depth > 0 && _depth < simulated.size());
+			swap(simulated.back(), simulated[simulated.size() - _depth - 1]);
+		},
+		[&](StackSlot const& _slot) {
+			BOOST_REQUIRE(canBeFreelyGenerated(_slot) || depthOf(simulated, _slot));
+			simulated.emplace_back(_slot);
+		},
+		[&]() {
+			BOOST_REQUIRE(!simulated.empty());
+			simulated.pop_back();
+		}
+	);
+	BOOST_REQUIRE_EQUAL(simulated.size(), _target.size());
+	for (size_t i = 0; i < _target.size(); ++i)
+		if (!holds_alternative<JunkSlot>(_target[i]))
+			BOOST_CHECK_MESSAGE(
+				simulated[i] == _target[i],
+				stackToString(_current) + " -> " + stackToString(_target) + " resulted in " + stackToString(simulated)
+			);
+}
+
+bytes assemble(string const& _source, bool _optimizeStackLayout)
+{
+	OptimiserSettings settings = OptimiserSettings::none();
+	settings.optimizeStackLayout = _optimizeStackLayout;
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		settings
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	return stack.assemble(AssemblyStack::Machine::EVM).bytecode->bytecode;
+}
+
+/// @returns the bytecode for @a _source or nullopt if it is not valid strict assembly
+/// or runs into "stack too deep".
+optional<bytes> tryAssemble(string const& _source, bool _optimizeStackLayout)
+{
+	OptimiserSettings settings = OptimiserSettings::none();
+	settings.optimizeStackLayout = _optimizeStackLayout;
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		settings
+	);
+	if (!stack.parseAndAnalyze("", _source))
+		return nullopt;
+	try
+	{
+		return stack.assemble(AssemblyStack::Machine::EVM).bytecode->bytecode;
+	}
+	catch (StackTooDeepError const&)
+	{
+		return nullopt;
+	}
+}
+
+/// Deploys the same runtime code compiled with both code transforms and compares the
+/// results of calls to the two contracts.
+class StackLayoutExecutionFramework: public solidity::test::ExecutionFramework
+{
+public:
+	bytes const& compileAndRunWithoutCheck(
+		map<string, string> const& _sourceCode,
+		u256 const& _value = 0,
+		string const& = "",
+		bytes const& _arguments = {},
+		map<string, util::h160> const& = {},
+		optional<string> const& = nullopt
+	) override
+	{
+		BOOST_REQUIRE(_sourceCode.size() == 1);
+		sendMessage(assemble(_sourceCode.begin()->second, m_optimizeStackLayout) + _arguments, true, _value);
+		return m_output;
+	}
+
+protected:
+	/// Calls both versions of @a _runtimeCode with each of @a _inputs and checks that
+	/// success and return or revert data are the same.
+	void compareTransforms(string const& _runtimeCode, vector<bytes> const& _inputs)
+	{
+		string const source =
+			"object \"A\" {\n"
+			"	code {\n"
+			"		datacopy(0, dataoffset(\"R\"), datasize(\"R\"))\n"
+			"		return(0, datasize(\"R\"))\n"
+			"	}\n"
+			"	object \"R\" { code {\n" + _runtimeCode + "\n} }\n"
+			"}\n";
+		vector<util::h160> contracts;
+		for (bool optimizeStackLayout: {false, true})
+		{
+			m_optimizeStackLayout = optimizeStackLayout;
+			compileAndRunWithoutCheck({{"", source}});
+			BOOST_REQUIRE(m_transactionSuccessful);
+			contracts.push_back(m_contractAddress);
+		}
+		for (bytes const& input: _inputs)
+		{
+			vector<pair<bool, bytes>> results;
+			for (util::h160 const& contract: contracts)
+			{
+				m_contractAddress = contract;
+				sendMessage(input, false);
+				results.emplace_back(m_transactionSuccessful, m_output);
+			}
+			BOOST_CHECK_MESSAGE(
+				results.front() == results.back(),
+				"Results differ for input " + util::toHex(input) + ": " +
+				util::toHex(results.front().second) + " vs. " + util::toHex(results.back().second)
+			);
+		}
+	}
+
+	bool m_optimizeStackLayout = false;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulStackLayout)
+
+BOOST_AUTO_TEST_CASE(shuffle_examples)
+{
+	vector<Scope::Variable> variables(3);
+	StackSlot a = VariableSlot{&variables[0]};
+	StackSlot b = VariableSlot{&variables[1]};
+	StackSlot c = VariableSlot{&variables[2]};
+	StackSlot one = LiteralSlot{1};
+
+	checkShuffle({}, {});
+	checkShuffle({a, b}, {b, a});
+	checkShuffle({a, b, c}, {c, b, a, a});
+	checkShuffle({a, b, c}, {b});
+	checkShuffle({a, b}, {one, a, one, b});
+	checkShuffle({a, b, c}, {JunkSlot{}, c, a});
+	checkShuffle({c, b, a}, {JunkSlot{}, JunkSlot{}});
+}
+
+BOOST_AUTO_TEST_CASE(shuffle_random)
+{
+	mt19937 generator(1);
+	vector<Scope::Variable> variables(10);
+	auto randomSlot = [&]() -> StackSlot {
+		switch (generator() % 4)
+		{
+			case 0: return LiteralSlot{generator() % 3};
+			case 1: return JunkSlot{};
+			default: return VariableSlot{&variables[generator() % variables.size()]};
+		}
+	};
+	for (size_t iteration = 0; iteration < 2000; ++iteration)
+	{
+		Stack current(generator() % 12);
+		Stack target(generator() % 12);
+		for (StackSlot& slot: current)
+			slot = randomSlot();
+		for (StackSlot& slot: target)
+		{
+			slot = randomSlot();
+			// Variables can only be duplicated, not created.
+			if (holds_alternative<VariableSlot>(slot) && !depthOf(current, slot))
+				slot = LiteralSlot{7};
+		}
+		checkShuffle(current, target);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(smaller_code)
+{
+	string const source = R"(
+		object "A" {
+			code {
+				function f(a, b) -> c, d {
+					c := add(a, b)
+					d := mul(a, b)
+					if gt(c, 10) { leave }
+					d := sub(d, c)
+				}
+				let x := calldataload(0)
+				let y := calldataload(32)
+				for { let i := 0 } lt(i, 10) { i := add(i, 1) } {
+					switch and(i, 1)
+					case 0 { x, y := f(x, i) }
+					default { y := add(y, 1) }
+				}
+				sstore(x, y)
+				if iszero(x) { revert(0, 0) }
+			}
+		}
+	)";
+	bytes original = assemble(source, false);
+	bytes optimized = assemble(source, true);
+	BOOST_CHECK(!optimized.empty());
+	BOOST_CHECK_LT(optimized.size(), original.size());
+}
+
+BOOST_AUTO_TEST_CASE(no_regressions_on_yul_tests)
+{
+	// All Yul test files that compile with CodeTransform also have to compile with the stack
+	// layout optimization. Objects it cannot handle are compiled with CodeTransform instead.
+	size_t compiled = 0;
+	for (char const* directory: {"evmCodeTransform", "objectCompiler", "yulInterpreterTests", "yulOptimizerTests"})
+	{
+		boost::filesystem::path const path = solidity::test::CommonOptions::get().testPath / "libyul" / directory;
+		for (auto const& entry: boost::make_iterator_range(boost::filesystem::recursive_directory_iterator(path), {}))
+		{
+			if (entry.path().extension() != ".yul")
+				continue;
+			string const source = util::readFileAsString(entry.path().string());
+			if (!tryAssemble(source, false))
+				continue;
+			BOOST_CHECK_MESSAGE(tryAssemble(source, true).has_value(), entry.path().string());
+			++compiled;
+		}
+	}
+	BOOST_CHECK(compiled > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(YulStackLayoutExecution, StackLayoutExecutionFramework)
+
+BOOST_AUTO_TEST_CASE(switch_and_loops)
+{
+	string const code = R"(
+		let n := calldataload(0)
+		let sum := 0
+		for { let i := 0 } 1 { i := add(i, 1) } {
+			if eq(i, n) { break }
+			switch mod(i, 3)
+			case 0 { continue }
+			case 1 { sum := add(sum, i) }
+			default { sum := mul(add(sum, 1), 2) }
+			let j := i
+			for {} gt(j, 0) { j := shr(1, j) } {
+				if and(j, 4) { continue }
+				if eq(j, 9) { break }
+				sum := xor(sum, j)
+			}
+		}
+		mstore(0, sum)
+		mstore(32, n)
+		return(0, 64)
+	)";
+	compareTransforms(code, {encodeArgs(0), encodeArgs(1), encodeArgs(7), encodeArgs(40)});
+}
+
+BOOST_AUTO_TEST_CASE(leave_and_recursion)
+{
+	string const code = R"(
+		function fib(n) -> r {
+			if lt(n, 2) {
+				r := n
+				leave
+			}
+			r := add(fib(sub(n, 1)), fib(sub(n, 2)))
+		}
+		function findRoot(start, square) -> i, found {
+			for { i := start } lt(i, 100) { i := add(i, 1) } {
+				if eq(mul(i, i), square) {
+					found := 1
+					leave
+				}
+			}
+			i := 0
+		}
+		function sumDown(a, b, c) -> s {
+			switch a
+			case 0 { s := add(b, c) }
+			default { s := add(a, sumDown(sub(a, 1), c, b)) }
+		}
+		let n := calldataload(0)
+		let root, found := findRoot(0, calldataload(32))
+		mstore(0, fib(mod(n, 15)))
+		mstore(32, root)
+		mstore(64, found)
+		mstore(96, sumDown(mod(n, 20), n, root))
+		return(0, 128)
+	)";
+	compareTransforms(code, {
+		encodeArgs(0, 0),
+		encodeArgs(1, 4),
+		encodeArgs(10, 81),
+		encodeArgs(14, 82),
+		encodeArgs(33, 9801)
+	});
+}
+
+BOOST_AUTO_TEST_CASE(terminating_blocks)
+{
+	string const code = R"(
+		function fail(code) {
+			mstore(0, code)
+			revert(0, 32)
+		}
+		function check(x) -> y {
+			if gt(x, 10) { fail(add(x, 1000)) }
+			y := add(x, 1)
+		}
+		let a := calldataload(0)
+		let b := calldataload(32)
+		switch a
+		case 0 { invalid() }
+		case 1 {
+			mstore(0, b)
+			return(0, 32)
+		}
+		case 2 { a := add(a, b) }
+		case 3 { stop() }
+		default {
+			let c := check(a)
+			if eq(c, 5) {
+				mstore(0, add(b, c))
+				revert(0, 32)
+			}
+			for {} 1 {} {
+				if gt(b, c) { fail(b) }
+				b := add(b, 1)
+				if eq(b, 8) { return(0, 0) }
+			}
+		}
+		mstore(0, a)
+		return(0, 32)
+	)";
+	compareTransforms(code, {
+		encodeArgs(0, 0),
+		encodeArgs(1, 7),
+		encodeArgs(2, 5),
+		encodeArgs(3, 0),
+		encodeArgs(4, 1),
+		encodeArgs(5, 1),
+		encodeArgs(9, 3),
+		encodeArgs(9, 20),
+		encodeArgs(11, 0)
+	});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,102 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the YulString repository.
+ */
+
+#include <libyul/YulString.h>
+
+#include <libyul/AST.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringRepositoryTest)
+
+BOOST_AUTO_TEST_CASE(empty_string)
+{
+	BOOST_CHECK(YulString{}.empty());
+	BOOST_CHECK(YulString{""}.empty());
+	BOOST_CHECK(YulString{""} == YulString{});
+	BOOST_CHECK_EQUAL(YulString{}.hash(), YulStringRepository::emptyHash());
+	BOOST_CHECK(!YulString{"x"}.empty());
+}
+
+BOOST_AUTO_TEST_CASE(identity)
+{
+	vector<YulString> strings;
+	for (size_t i = 0; i < 5000; ++i)
+		strings.emplace_back("identity_test_" + to_string(i));
+	for (size_t i = 0; i < strings.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(strings[i].str(), "identity_test_" + to_string(i));
+		BOOST_CHECK(strings[i] == YulString{"identity_test_" + to_string(i)});
+		if (i > 0)
+			BOOST_CHECK(strings[i] != strings[i - 1]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_interning)
+{
+	size_t const stringCount = 2000;
+	size_t const threadCount = 8;
+	vector<vector<YulString>> results(threadCount);
+	vector<exception_ptr> failures = util::parallelFor(threadCount, threadCount, [&](size_t _thread) {
+		for (size_t i = 0; i < stringCount; ++i)
+			results[_thread].emplace_back("concurrent_test_" + to_string((i + _thread * 7) % stringCount));
+	});
+	for (exception_ptr const& failure: failures)
+		BOOST_REQUIRE(!failure);
+
+	for (size_t thread = 0; thread < threadCount; ++thread)
+		for (size_t i = 0; i < stringCount; ++i)
+		{
+			size_t index = (i + thread * 7) % stringCount;
+			BOOST_CHECK_EQUAL(results[thread][i].str(), "concurrent_test_" + to_string(index));
+			BOOST_CHECK(results[thread][i] == results[0][index]);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(number_literal_values_across_reset)
+{
+	auto value = [](string const& _number) {
+		return valueOfNumberLiteral(Literal{{}, LiteralKind::Number, YulString{_number}, {}});
+	};
+	// The values of number literals are cached by string ID and IDs are reused after a reset.
+	{
+		YulStringRepository::Scope scope;
+		for (size_t i = 0; i < 100; ++i)
+			BOOST_CHECK_EQUAL(value(to_string(i)), u256(i));
+	}
+	{
+		YulStringRepository::Scope scope;
+		for (size_t i = 0; i < 100; ++i)
+			BOOST_CHECK_EQUAL(value(to_string(i + 1000)), u256(i + 1000));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -136,6 +136,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--overwrite",
 			"--evm-version=spuriousDragon",
 			"--experimental-via-ir",
+			"--jobs=4",
 			"--revert-strings=strip",
 			"--pretty-json",
 			"--no-color",
@@ -158,6 +159,8 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--model-checker-engine=bmc",
 			"--model-checker-targets=underflow,divByZero",
 			"--model-checker-timeout=5",
+			"--model-checker-race-solvers",
+			"--model-checker-jobs=4",
 		};
 
 		if (inputMode == InputMode::CompilerWithASTImport)
@@ -182,6 +185,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.output.overwriteFiles = true;
 		expectedOptions.output.evmVersion = EVMVersion::spuriousDragon();
 		expectedOptions.output.experimentalViaIR = true;
+		expectedOptions.output.jobs = 4;
 		expectedOptions.output.revertStrings = RevertStrings::Strip;
 		expectedOptions.linker.libraries = {
 			{"dir1/file1.sol:L", h160("1234567890123456789012345678901234567890")},
@@ -214,6 +218,8 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{true, false},
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
 			5,
+			true,
+			4,
 		};
 
 		stringstream sout, serr;
@@ -352,6 +358,9 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 		"--standard-json",
 		"--base-path=/home/user/",
 		"--allow-paths=/tmp,/home,project,../contracts",
+		"--cache-dir=/tmp/cache",
+		"--cache-size=64",
+		"--cache-stats",
 		"--ignore-missing",                // Ignored in Standard JSON mode
 		"--error-recovery",                // Ignored in Standard JSON mode
 		"--output-dir=/tmp/out",           // Accepted but has no effect in Standard JSON mode
@@ -392,6 +401,9 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 	expectedOptions.input.standardJsonFile = "input.json";
 	expectedOptions.input.basePath = "/home/user/";
 	expectedOptions.input.allowedDirectories = {"/tmp", "/home", "project", "../contracts"};
+	expectedOptions.cache.directory = "/tmp/cache";
+	expectedOptions.cache.maxSizeMiB = 64;
+	expectedOptions.cache.printStats = true;
 	expectedOptions.output.dir = "/tmp/out";
 	expectedOptions.output.overwriteFiles = true;
 	expectedOptions.output.revertStrings = RevertStrings::Strip;
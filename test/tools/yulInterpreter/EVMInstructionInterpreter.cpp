@@ -69,12 +69,20 @@ u256 readZeroExtended(bytes const& _data, u256 const& _offset)
 /// @a _target at offset @a _targetOffset. Behaves as if @a _source would
 /// continue with an infinite sequence of zero bytes beyond its end.
 void copyZeroExtended(
-	map<u256, uint8_t>& _target, bytes const& _source,
+	InterpreterMemory& _target, bytes const& _source,
 	size_t _targetOffset, size_t _sourceOffset, size_t _size
 )
 {
+	bytes data(_size, 0);
 	for (size_t i = 0; i < _size; ++i)
-		_target[_targetOffset + i] = _sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0;
+		if (_sourceOffset + i < _source.size())
+			data[i] = _source[_sourceOffset + i];
+	if (_targetOffset + _size >= _targetOffset)
+		_target.write(_targetOffset, bytesConstRef(&data));
+	else
+		// The target offset wraps around.
+		for (size_t i = 0; i < _size; ++i)
+			_target.set(_targetOffset + i, data[i]);
 }
 
 }
@@ -268,10 +276,12 @@ u256 EVMInstructionInterpreter::eval(
 		return 0;
 	case Instruction::MSTORE8:
 		accessMemory(arg[0], 1);
-		m_state.memory[arg[0]] = uint8_t(arg[1] & 0xff);
+		m_state.memory.set(arg[0], uint8_t(arg[1] & 0xff));
 		return 0;
 	case Instruction::SLOAD:
-		return m_state.storage[h256(arg[0])];
+		if (auto slot = m_state.storage.find(h256(arg[0])); slot != m_state.storage.end())
+			return u256(slot->second);
+		return 0;
 	case Instruction::SSTORE:
 		m_state.storage[h256(arg[0])] = h256(arg[1]);
 		return 0;
@@ -482,10 +492,7 @@ bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _s
 bytes EVMInstructionInterpreter::readMemory(u256 const& _offset, u256 const& _size)
 {
 	yulAssert(_size <= 0xffff, "Too large read.");
-	bytes data(size_t(_size), uint8_t(0));
-	for (size_t i = 0; i < data.size(); ++i)
-		data[i] = m_state.memory[_offset + i];
-	return data;
+	return m_state.memory.read(_offset, size_t(_size));
 }
 
 u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
@@ -495,8 +502,7 @@ u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
 
 void EVMInstructionInterpreter::writeMemoryWord(u256 const& _offset, u256 const& _value)
 {
-	for (size_t i = 0; i < 32; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (8 * (31 - i))) & 0xff);
+	m_state.memory.write(_offset, h256(_value).ref());
 }
 
 
@@ -507,13 +513,7 @@ void EVMInstructionInterpreter::logTrace(evmasm::Instruction _instruction, std::
 
 void EVMInstructionInterpreter::logTrace(std::string const& _pseudoInstruction, std::vector<u256> const& _arguments, bytes const& _data)
 {
-	string message = _pseudoInstruction + "(";
-	for (size_t i = 0; i < _arguments.size(); ++i)
-		message += (i > 0 ? ", " : "") + util::formatNumber(_arguments[i]);
-	message += ")";
-	if (!_data.empty())
-		message += " [" + util::toHex(_data) + "]";
-	m_state.trace.emplace_back(std::move(message));
+	m_state.trace.emplace_back(_pseudoInstruction, _arguments, _data);
 	if (m_state.maxTraceSize > 0 && m_state.trace.size() >= m_state.maxTraceSize)
 	{
 		m_state.trace.emplace_back("Trace size limit reached.");
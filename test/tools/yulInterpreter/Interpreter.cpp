@@ -38,6 +38,8 @@
 
 #include <range/v3/view/reverse.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <ostream>
 #include <variant>
 
@@ -48,25 +50,125 @@ using namespace solidity::yul::test;
 
 using solidity::util::h256;
 
+uint8_t InterpreterMemory::get(u256 const& _address) const
+{
+	if (_address < flatSize)
+	{
+		size_t address = static_cast<size_t>(_address);
+		return address < m_flat.size() ? m_flat[address] : 0;
+	}
+	auto page = m_pages.find(_address & ~u256(pageSize - 1));
+	if (page == m_pages.end())
+		return 0;
+	return page->second[static_cast<size_t>(_address & (pageSize - 1))];
+}
+
+void InterpreterMemory::set(u256 const& _address, uint8_t _value)
+{
+	if (_address < flatSize)
+	{
+		size_t address = static_cast<size_t>(_address);
+		if (address >= m_flat.size())
+		{
+			if (_value == 0)
+				return;
+			m_flat.resize(address + 1);
+		}
+		m_flat[address] = _value;
+		return;
+	}
+	u256 pageAddress = _address & ~u256(pageSize - 1);
+	auto page = m_pages.find(pageAddress);
+	if (page == m_pages.end())
+	{
+		if (_value == 0)
+			return;
+		page = m_pages.emplace(pageAddress, std::array<uint8_t, pageSize>{}).first;
+	}
+	page->second[static_cast<size_t>(_address & (pageSize - 1))] = _value;
+}
+
+bytes InterpreterMemory::read(u256 const& _address, size_t _size) const
+{
+	bytes data(_size, 0);
+	if (_address < flatSize && _size <= flatSize - static_cast<size_t>(_address))
+	{
+		size_t address = static_cast<size_t>(_address);
+		if (address < m_flat.size())
+			memcpy(data.data(), m_flat.data() + address, min(_size, m_flat.size() - address));
+	}
+	else
+		for (size_t i = 0; i < _size; ++i)
+			data[i] = get(_address + i);
+	return data;
+}
+
+void InterpreterMemory::write(u256 const& _address, bytesConstRef _data)
+{
+	if (_address < flatSize && _data.size() <= flatSize - static_cast<size_t>(_address))
+	{
+		size_t address = static_cast<size_t>(_address);
+		if (address + _data.size() > m_flat.size())
+			m_flat.resize(address + _data.size());
+		if (!_data.empty())
+			memcpy(m_flat.data() + address, _data.data(), _data.size());
+	}
+	else
+		for (size_t i = 0; i < _data.size(); ++i)
+			set(_address + i, _data[i]);
+}
+
+vector<pair<u256, h256>> InterpreterMemory::nonZeroWords() const
+{
+	vector<pair<u256, h256>> words;
+	auto addWords = [&](u256 const& _address, uint8_t const* _data, size_t _size) {
+		for (size_t offset = 0; offset < _size; offset += 0x20)
+		{
+			h256 word;
+			memcpy(word.data(), _data + offset, min<size_t>(0x20, _size - offset));
+			if (word != h256{})
+				words.emplace_back(_address + offset, word);
+		}
+	};
+	addWords(0, m_flat.data(), m_flat.size());
+	for (auto const& [address, page]: m_pages)
+		addWords(address, page.data(), page.size());
+	return words;
+}
+
+string TraceEntry::toString() const
+{
+	if (isMessage)
+		return name;
+	string message = name + "(";
+	for (size_t i = 0; i < arguments.size(); ++i)
+		message += (i > 0 ? ", " : "") + util::formatNumber(arguments[i]);
+	message += ")";
+	if (!data.empty())
+		message += " [" + util::toHex(data) + "]";
+	return message;
+}
+
 void InterpreterState::dumpStorage(ostream& _out) const
 {
+	// Print the slots in ascending order, independent of the hash table.
+	vector<pair<h256 const, h256> const*> slots;
 	for (auto const& slot: storage)
 		if (slot.second != h256{})
-			_out << "  " << slot.first.hex() << ": " << slot.second.hex() << endl;
+			slots.emplace_back(&slot);
+	sort(slots.begin(), slots.end(), [](auto const* _a, auto const* _b) { return _a->first < _b->first; });
+	for (auto const* slot: slots)
+		_out << "  " << slot->first.hex() << ": " << slot->second.hex() << endl;
 }
 
 void InterpreterState::dumpTraceAndState(ostream& _out) const
 {
 	_out << "Trace:" << endl;
-	for (auto const& line: trace)
-		_out << "  " << line << endl;
+	for (auto const& entry: trace)
+		_out << "  " << entry.toString() << endl;
 	_out << "Memory dump:\n";
-	map<u256, u256> words;
-	for (auto const& [offset, value]: memory)
-		words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-	for (auto const& [offset, value]: words)
-		if (value != 0)
-			_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << endl;
+	for (auto const& [offset, value]: memory.nonZeroWords())
+		_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << value.hex() << endl;
 	_out << "Storage dump:" << endl;
 	dumpStorage(_out);
 }
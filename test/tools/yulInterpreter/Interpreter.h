@@ -29,7 +29,9 @@
 
 #include <libsolutil/Exceptions.h>
 
+#include <array>
 #include <map>
+#include <unordered_map>
 
 namespace solidity::yul
 {
@@ -67,14 +69,88 @@ enum class ControlFlowState
 	Leave
 };
 
+/**
+ * Byte-addressed memory of the interpreter. Bytes that were never written read as zero and
+ * addresses wrap around at 2**256.
+ * The low addresses commonly used by code are stored in a contiguous byte vector, higher
+ * addresses in separately allocated pages.
+ */
+class InterpreterMemory
+{
+public:
+	/// @returns the byte at @a _address.
+	uint8_t get(u256 const& _address) const;
+	void set(u256 const& _address, uint8_t _value);
+	/// @returns @a _size bytes starting at @a _address.
+	bytes read(u256 const& _address, size_t _size) const;
+	/// Writes @a _data starting at @a _address.
+	void write(u256 const& _address, bytesConstRef _data);
+
+	/// @returns all 32-byte aligned words that are not zero, in ascending order of their addresses.
+	std::vector<std::pair<u256, util::h256>> nonZeroWords() const;
+
+private:
+	/// Addresses below this are stored in m_flat.
+	static size_t constexpr flatSize = 0x10000;
+	/// Size of the pages used for higher addresses. Has to be a multiple of 32.
+	static size_t constexpr pageSize = 0x100;
+
+	/// Memory below flatSize, up to the highest address written so far.
+	bytes m_flat;
+	/// Memory at or above flatSize, keyed by the address of the first byte of each page.
+	std::map<u256, std::array<uint8_t, pageSize>> m_pages;
+};
+
+/// Hash function for storage slots.
+struct StorageSlotHash
+{
+	size_t operator()(util::h256 const& _slot) const
+	{
+		return boost::hash_range(_slot.data(), _slot.data() + util::h256::size);
+	}
+};
+
+/**
+ * Entry of the execution trace. It is kept in structured form and only converted to text
+ * when the trace is printed.
+ */
+struct TraceEntry
+{
+	/// Creates an entry that consists of the message @a _message only.
+	explicit TraceEntry(std::string _message): name(std::move(_message)), isMessage(true) {}
+	TraceEntry(std::string _name, std::vector<u256> _arguments, bytes _data):
+		name(std::move(_name)), arguments(std::move(_arguments)), data(std::move(_data))
+	{}
+
+	/// @returns the entry in the form "NAME(arg1, arg2) [data]" or the message.
+	std::string toString() const;
+
+	bool operator==(TraceEntry const& _other) const
+	{
+		return
+			isMessage == _other.isMessage &&
+			name == _other.name &&
+			arguments == _other.arguments &&
+			data == _other.data;
+	}
+	bool operator!=(TraceEntry const& _other) const { return !(*this == _other); }
+
+	/// Name of the instruction or pseudo-instruction, or the message.
+	std::string name;
+	std::vector<u256> arguments;
+	/// Auxiliary data, e.g. the data returned by RETURN.
+	bytes data;
+	bool isMessage = false;
+};
+
 struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
+	InterpreterMemory memory;
 	/// This is different than memory.size() because we ignore gas.
 	u256 msize;
-	std::map<util::h256, util::h256> storage;
+	std::unordered_map<util::h256, util::h256, StorageSlotHash> storage;
 	util::h160 address = util::h160("0x0000000000000000000000000000000011111111");
 	u256 balance = 0x22222222;
 	u256 selfbalance = 0x22223333;
@@ -90,8 +166,8 @@ struct InterpreterState
 	u256 difficulty = 0x9999999;
 	u256 gaslimit = 4000000;
 	u256 chainid = 0x01;
-	/// Log of changes / effects. Sholud be structured data in the future.
-	std::vector<std::string> trace;
+	/// Log of changes / effects.
+	std::vector<TraceEntry> trace;
 	/// This is actually an input parameter that more or less limits the runtime.
 	size_t maxTraceSize = 0;
 	size_t maxSteps = 0;
@@ -149,7 +225,7 @@ public:
 	void operator()(Leave const&) override;
 	void operator()(Block const& _block) override;
 
-	std::vector<std::string> const& trace() const { return m_state.trace; }
+	std::vector<TraceEntry> const& trace() const { return m_state.trace; }
 
 	u256 valueOfVariable(YulString _name) const { return m_variables.at(_name); }
 